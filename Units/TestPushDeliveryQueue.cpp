@@ -0,0 +1,212 @@
+/*
+ * ExtraChain Console Client
+ * Copyright (C) 2025 ExtraChain Foundation <official@extrachain.io>
+ *
+ * This library is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "gtest/gtest.h"
+
+#include <QCoreApplication>
+#include <QDeadlineTimer>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QTcpServer>
+#include <QTcpSocket>
+
+#include <functional>
+
+#include "console/push_delivery_queue.h"
+
+namespace {
+
+// Minimal HTTP server standing in for the push server. Every POST body is handed to
+// the handler, which returns the status code and JSON body of the answer.
+class MockPushServer : public QObject {
+public:
+    using Handler = std::function<std::pair<int, QJsonObject>(const QJsonObject &)>;
+
+    explicit MockPushServer(Handler handler)
+        : handler(std::move(handler)) {
+        server.listen(QHostAddress::LocalHost);
+        connect(&server, &QTcpServer::newConnection, this, [this] {
+            while (auto socket = server.nextPendingConnection())
+                connect(socket, &QTcpSocket::readyRead, this, [this, socket] { read(socket); });
+        });
+    }
+
+    QString url() const {
+        return QString("http://127.0.0.1:%1/").arg(server.serverPort());
+    }
+
+    int requests = 0;
+
+private:
+    void read(QTcpSocket *socket) {
+        auto &buffer = buffers[socket];
+        buffer += socket->readAll();
+
+        const qsizetype headerEnd = buffer.indexOf("\r\n\r\n");
+        if (headerEnd < 0)
+            return;
+        qsizetype length = 0;
+        for (const auto &line : buffer.left(headerEnd).split('\n')) {
+            if (line.toLower().startsWith("content-length:"))
+                length = line.mid(15).trimmed().toLongLong();
+        }
+        if (buffer.size() < headerEnd + 4 + length)
+            return;
+
+        ++requests;
+        const auto [status, answer] = handler(QJsonDocument::fromJson(buffer.mid(headerEnd + 4, length)).object());
+        const auto body             = QJsonDocument(answer).toJson(QJsonDocument::Compact);
+        socket->write(QString("HTTP/1.1 %1 Status\r\nContent-Type: application/json\r\n"
+                              "Content-Length: %2\r\nConnection: close\r\n\r\n")
+                          .arg(status)
+                          .arg(body.size())
+                          .toLatin1()
+                      + body);
+        socket->disconnectFromHost();
+        buffers.remove(socket);
+    }
+
+    Handler                         handler;
+    QTcpServer                      server;
+    QHash<QTcpSocket *, QByteArray> buffers;
+};
+
+QJsonObject results(const QJsonObject &request, const QString &errorType, int skip = 0) {
+    QJsonArray list;
+    for (const auto &value : request["notifications"].toArray()) {
+        if (skip-- > 0)
+            continue;
+        list.append(QJsonObject { { "token", value["token"] }, { "errorType", errorType } });
+    }
+    return { { "results", list } };
+}
+
+void enqueue(PushDeliveryQueue &queue, const QString &server, int count) {
+    for (int i = 0; i < count; ++i) {
+        const QString token = QString("token-%1").arg(i);
+        queue.enqueue(server, { .actorKey = "actor", .token = token, .payload = { { "token", token } } });
+    }
+}
+
+bool waitFor(const std::function<bool()> &condition, int timeout = 10000) {
+    QDeadlineTimer deadline(timeout);
+    while (!condition() && !deadline.hasExpired())
+        QCoreApplication::processEvents(QEventLoop::AllEvents, 50);
+    return condition();
+}
+
+class PushDeliveryQueueTest : public ::testing::Test {
+protected:
+    static void SetUpTestSuite() {
+        static int   argc   = 1;
+        static char  name[] = "PushDeliveryQueueTests";
+        static char *argv[] = { name, nullptr };
+        if (QCoreApplication::instance() == nullptr)
+            new QCoreApplication(argc, argv);
+    }
+};
+
+}
+
+TEST_F(PushDeliveryQueueTest, client_errors_are_not_retried) {
+    for (int status : { 400, 401, 404 }) {
+        MockPushServer server([status](const QJsonObject &) {
+            return std::pair { status, QJsonObject() };
+        });
+        PushDeliveryQueue queue;
+        enqueue(queue, server.url(), 3);
+
+        ASSERT_TRUE(waitFor([&] { return queue.stats().dropped == 3; }));
+        QCoreApplication::processEvents();
+        EXPECT_EQ(server.requests, 1);
+        EXPECT_EQ(queue.stats().retried, 0);
+    }
+}
+
+TEST_F(PushDeliveryQueueTest, server_errors_are_retried) {
+    for (int status : { 429, 503 }) {
+        MockPushServer server([&server, status](const QJsonObject &request) {
+            return server.requests == 1 ? std::pair { status, QJsonObject() }
+                                        : std::pair { 200, results(request, "None") };
+        });
+        PushDeliveryQueue queue;
+        enqueue(queue, server.url(), 3);
+
+        ASSERT_TRUE(waitFor([&] { return queue.stats().sent == 3; }));
+        EXPECT_EQ(server.requests, 2);
+        EXPECT_EQ(queue.stats().retried, 3);
+        EXPECT_EQ(queue.stats().dropped, 0);
+    }
+}
+
+TEST_F(PushDeliveryQueueTest, missing_tokens_are_requeued) {
+    MockPushServer server([&server](const QJsonObject &request) {
+        return std::pair { 200, results(request, "None", server.requests == 1 ? 2 : 0) };
+    });
+    PushDeliveryQueue queue;
+    enqueue(queue, server.url(), 5);
+
+    ASSERT_TRUE(waitFor([&] { return queue.stats().sent == 5; }));
+    EXPECT_EQ(server.requests, 2);
+    EXPECT_EQ(queue.stats().retried, 2);
+}
+
+TEST_F(PushDeliveryQueueTest, rejected_tokens_are_reported) {
+    MockPushServer server([](const QJsonObject &request) {
+        return std::pair { 200, results(request, "Unregistered") };
+    });
+    PushDeliveryQueue queue;
+    QStringList       rejected;
+    QObject::connect(&queue, &PushDeliveryQueue::tokenRejected, [&](std::string, QString token) {
+        rejected << token;
+    });
+    enqueue(queue, server.url(), 2);
+
+    ASSERT_TRUE(waitFor([&] { return rejected.size() == 2; }));
+    EXPECT_EQ(server.requests, 1);
+    EXPECT_EQ(queue.stats().rejected, 2);
+    EXPECT_EQ(queue.stats().retried, 0);
+}
+
+TEST_F(PushDeliveryQueueTest, repeated_tokens_are_answered_one_by_one) {
+    MockPushServer server([](const QJsonObject &request) {
+        return std::pair { 200, results(request, "None") };
+    });
+    PushDeliveryQueue queue;
+    const QJsonObject payload { { "token", "token" } };
+    for (int i = 0; i < 3; ++i)
+        queue.enqueue(server.url(), { .actorKey = "actor", .token = "token", .payload = payload });
+
+    ASSERT_TRUE(waitFor([&] { return queue.stats().sent == 3; }));
+    EXPECT_EQ(server.requests, 1);
+    EXPECT_EQ(queue.stats().retried, 0);
+}
+
+TEST_F(PushDeliveryQueueTest, unknown_errors_are_counted) {
+    MockPushServer server([](const QJsonObject &request) {
+        return std::pair { 200, results(request, "PayloadTooLarge") };
+    });
+    PushDeliveryQueue queue;
+    enqueue(queue, server.url(), 2);
+
+    ASSERT_TRUE(waitFor([&] { return queue.stats().failed == 2; }));
+    EXPECT_EQ(server.requests, 1);
+    EXPECT_EQ(queue.stats().sent, 0);
+    EXPECT_EQ(queue.stats().retried, 0);
+}
@@ -0,0 +1,60 @@
+/*
+ * ExtraChain Console Client
+ * Copyright (C) 2025 ExtraChain Foundation <official@extrachain.io>
+ *
+ * This library is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef BALANCECLEANER_H
+#define BALANCECLEANER_H
+
+#include <QElapsedTimer>
+#include <QObject>
+#include <QTimer>
+
+#include <vector>
+
+#include "managers/extrachain_node.h"
+
+// Maintenance job behind --clear-balance. Transactions leaving a negative balance
+// are dropped, then balances of the affected actors are recalculated in chunks with
+// progress and ETA. Everything runs on the node's thread, the event loop gets control
+// back between chunks.
+class BalanceCleaner : public QObject {
+    Q_OBJECT
+
+public:
+    explicit BalanceCleaner(ExtraChainNode *node, QObject *parent = nullptr);
+
+    void setChunkSize(qint64 size);
+    void start();
+
+signals:
+    void finished(bool success);
+
+private:
+    void nextChunk();
+    void printProgress() const;
+
+    ExtraChainNode      *node;
+    QTimer               progressTimer;
+    QElapsedTimer        timer;
+    std::vector<ActorId> actors;
+    size_t               chunkSize = 1000;
+    size_t               done      = 0;
+    size_t               doneChunk = 0;
+};
+
+#endif // BALANCECLEANER_H
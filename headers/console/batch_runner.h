@@ -0,0 +1,65 @@
+/*
+ * ExtraChain Console Client
+ * Copyright (C) 2025 ExtraChain Foundation <official@extrachain.io>
+ *
+ * This library is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef BATCHRUNNER_H
+#define BATCHRUNNER_H
+
+#include <QElapsedTimer>
+#include <QObject>
+#include <QStringList>
+#include <QTimer>
+
+class ConsoleManager;
+
+// Runs console commands from a file or stdin in order and stops on the first
+// error. Commands that complete asynchronously (CommandStatus::Pending) are not
+// awaited one by one; the batch waits for all of them once the last line has run,
+// and stops as soon as one of them reports a failure.
+class BatchRunner : public QObject {
+    Q_OBJECT
+
+public:
+    explicit BatchRunner(ConsoleManager *console, QObject *parent = nullptr);
+
+    bool loadFile(const QString &path);
+    bool loadStdin();
+    void setTimeout(int seconds);
+
+public slots:
+    void start();
+
+signals:
+    void finished(bool success);
+
+private:
+    void load(QIODevice &device);
+    void runNext();
+    void waitPending();
+    void finish(bool success);
+
+    ConsoleManager *console;
+    QStringList     commands;
+    int             current = 0;
+    int             pending = 0;
+    bool            done    = false;
+    QElapsedTimer   elapsed;
+    QTimer          timeout;
+};
+
+#endif // BATCHRUNNER_H
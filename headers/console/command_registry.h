@@ -0,0 +1,76 @@
+/*
+ * ExtraChain Console Client
+ * Copyright (C) 2025 ExtraChain Foundation <official@extrachain.io>
+ *
+ * This library is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef COMMANDREGISTRY_H
+#define COMMANDREGISTRY_H
+
+#include <QHash>
+#include <QString>
+#include <QStringList>
+
+#include <functional>
+#include <vector>
+
+enum class CommandStatus {
+    Ok,
+    Pending, // accepted, completes asynchronously
+    Failed,
+    InvalidArguments,
+    NotFound
+};
+
+QString commandStatusName(CommandStatus status);
+
+struct CommandContext {
+    QStringList args; // tokens after the command name
+    QString     rest; // text after the command name with inner spaces kept
+};
+
+// Maps command lines to handlers. A command name can have several words
+// ("cn list"), lookup takes the longest registered name that prefixes the line.
+// Arguments are tokenized once and checked against minArgs/maxArgs before the
+// handler runs, so the registry can be fed from the console, scripts or sockets.
+class CommandRegistry {
+public:
+    using Handler = std::function<CommandStatus(const CommandContext &)>;
+
+    struct Command {
+        QString     name;
+        QString     usage;
+        QString     help;
+        int         minArgs   = 0;
+        int         maxArgs   = 0; // -1 for unlimited
+        bool        needsNode = true;
+        QStringList aliases;
+        Handler     handler;
+    };
+
+    void add(Command command);
+
+    const Command *find(const QStringList &tokens, int *words = nullptr) const;
+    CommandStatus  execute(const QString &line, bool nodeReady = true) const;
+    void           printHelp(const QString &name = {}) const;
+
+private:
+    std::vector<Command>   commands;
+    QHash<QString, size_t> index;
+    int                    maxWords = 1;
+};
+
+#endif // COMMANDREGISTRY_H
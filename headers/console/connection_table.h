@@ -0,0 +1,68 @@
+/*
+ * ExtraChain Console Client
+ * Copyright (C) 2025 ExtraChain Foundation <official@extrachain.io>
+ *
+ * This library is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef CONNECTIONTABLE_H
+#define CONNECTIONTABLE_H
+
+#include <QString>
+
+#include <optional>
+#include <vector>
+
+class ExtraChainNode;
+
+// Compact view of the node connections for "cn list", "cn top" and "cn stats". The
+// container is walked once and only the printed fields are kept, so sorting and
+// paging thousands of peers never touches the sockets again. The network manager
+// exposes no per-connection traffic or latency counters, so the stats are counts
+// over these fields.
+class ConnectionTable {
+public:
+    enum class SortKey { Ip, Port, Protocol, Active, Id };
+
+    struct Row {
+        QString ip;
+        qint64  port       = 0;
+        qint64  serverPort = 0;
+        bool    active     = false;
+        QString protocol;
+        QString identifier;
+    };
+
+    static constexpr int pageSize = 20;
+
+    static std::optional<SortKey> parseSortKey(const QString &name);
+
+    explicit ConnectionTable(ExtraChainNode *node);
+
+    size_t                  size() const;
+    const std::vector<Row> &list() const;
+    void                    sort(SortKey key);
+    void                    printPage(int page) const;
+    void                    printAll() const;
+    // totals for all connections, or for those with this id or ip; false if none match the id
+    bool                    printStats(const QString &id = {}) const;
+
+private:
+    void printRows(size_t begin, size_t end) const;
+
+    std::vector<Row> rows;
+};
+
+#endif // CONNECTIONTABLE_H
@@ -23,12 +23,24 @@
 #include <QObject>
 #include <QTextStream>
 
+#include <atomic>
+
+#ifdef Q_OS_UNIX
+    #include <QSocketNotifier>
+#endif
+
+// Delivers whole stdin lines through input(). On Unix stdin is watched by a
+// QSocketNotifier in the caller's event loop; on Windows process() runs in its own
+// thread. finished() is emitted once stdin reaches EOF or stop() is called.
 class ConsoleInput : public QObject {
     Q_OBJECT
 public:
     explicit ConsoleInput(QObject *parent = nullptr);
     ~ConsoleInput();
 
+    void start();
+    void stop();
+
 signals:
     void input(QString text);
     void finished();
@@ -37,7 +49,14 @@ public slots:
     void process();
 
 private:
-    QTextStream *notifierInput = nullptr;
+#ifdef Q_OS_UNIX
+    void readAvailable();
+    void emitLines();
+
+    QSocketNotifier *notifier = nullptr;
+    QByteArray       buffer;
+#endif
+    std::atomic_bool stopped = false;
 };
 
 #endif // WINDOWSINPUT_H
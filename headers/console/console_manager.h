@@ -23,14 +23,15 @@
 #include <QCoreApplication>
 #include <QNetworkAccessManager>
 
-#ifdef Q_OS_UNIX
-    #include <QSocketNotifier>
-#endif
-
+#include "console/command_registry.h"
 #include "console/console_input.h"
 #include "console/push_manager.h"
+#include "console/wallet_balances.h"
+#include "network/network_manager.h"
 
+class DfsExporter;
 class ExtraChainNode;
+class TransferMonitor;
 class AccountController;
 class NetworkManager;
 
@@ -43,30 +44,42 @@ public:
 
     PushManager *pushManager() const;
 
+    CommandStatus          execute(const QString &command);
+    const CommandRegistry &commands() const;
+    int                    pendingOperations() const;
+
     void setExtraChainNode(ExtraChainNode *node);
+    void setProtocol(Network::Protocol protocol);
     void startInput();
     void dfsStart();
+    // jobs started outside the console count too, so a batch run waits for them
+    void operationStarted();
+    void operationFinished(bool ok);
 
     static QString getSomething(const QString &name);
 
 signals:
     void textReceived(QString message);
+    void operationsFinished();
+    void operationFailed();
 
 public slots:
     void commandReceiver(QString command);
     void saveNotificationToken(QByteArray os, ActorId actorId, ActorId token);
 
 private:
-#ifdef Q_OS_UNIX
-        // QSocketNotifier notifier;
-        // QTextStream     notifierInput;
-#endif
-#ifdef Q_OS_WIN
-    ConsoleInput consoleInput;
-#endif
-
-    ExtraChainNode *node;
-    PushManager    *m_pushManager;
+    void registerCommands();
+
+    ConsoleInput    consoleInput;
+    CommandRegistry registry;
+    WalletBalances  m_balances;
+
+    ExtraChainNode       *node = nullptr;
+    PushManager          *m_pushManager;
+    DfsExporter          *m_dfsExporter;
+    TransferMonitor      *m_transfers;
+    int                   m_pendingOperations = 0;
+    Network::Protocol     m_protocol = Network::Protocol::WebSocket;
 };
 
 #endif // READER_H
@@ -0,0 +1,63 @@
+/*
+ * ExtraChain Console Client
+ * Copyright (C) 2025 ExtraChain Foundation <official@extrachain.io>
+ *
+ * This library is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef DFSEXPORTER_H
+#define DFSEXPORTER_H
+
+#include <QObject>
+#include <QSet>
+#include <QThreadPool>
+
+#include <filesystem>
+
+// Copies files out of the local DFS storage to a target folder. The export is raw:
+// bytes are copied as DFS keeps them in DFS_FOLDER, without going through the DFS
+// read path, so a file DFS stores encrypted comes out encrypted. Each file is
+// streamed in fixed-size chunks into "<name>.part" and renamed when complete, so
+// memory stays bounded. "<name>.part.source" records the source path, size and
+// modification time; an interrupted export resumes from the last whole chunk only
+// if the source is unchanged and starts over otherwise.
+// Several exports run concurrently on a dedicated pool, but never two to the same target.
+class DfsExporter : public QObject {
+    Q_OBJECT
+
+public:
+    static constexpr qint64 chunkSize = 1024 * 1024;
+
+    explicit DfsExporter(QObject *parent = nullptr);
+
+    void setConcurrency(int value);
+    bool exportFile(const std::filesystem::path &dfsFile,
+                    const std::filesystem::path &folder,
+                    const QString               &name = {});
+    int  active() const;
+
+signals:
+    void progress(QString file, qint64 done, qint64 total);
+    void exported(QString file, bool success, QString error);
+
+private:
+    void copy(std::filesystem::path source, std::filesystem::path target);
+
+    QThreadPool   pool;
+    QSet<QString> targets;
+    int           running = 0;
+};
+
+#endif // DFSEXPORTER_H
@@ -0,0 +1,100 @@
+/*
+ * ExtraChain Console Client
+ * Copyright (C) 2025 ExtraChain Foundation <official@extrachain.io>
+ *
+ * This library is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef DFSUPLOADER_H
+#define DFSUPLOADER_H
+
+#include <QElapsedTimer>
+#include <QHash>
+#include <QObject>
+#include <QTimer>
+
+#include <deque>
+#include <filesystem>
+#include <future>
+#include <set>
+#include <string>
+
+#include "dfs/dfs_controller.h"
+#include "managers/extrachain_node.h"
+
+// store_file returns the DirRow it added, DfsController::uploaded reports the same row
+inline std::string dfsFileId(const Dfs::DirRow &row) {
+    return row.file_id;
+}
+
+// Adds a file or, recursively, a directory to DFS. At most concurrency files are
+// handed to store_file at once; the next ones are read ahead in the background so
+// their data is in the page cache by the time DFS hashes and encrypts them.
+// Completion is matched by file id through DfsController::uploaded, also when it is
+// reported before store_file returns; an upload without progress for the idle
+// timeout counts as failed.
+class DfsUploader : public QObject {
+    Q_OBJECT
+
+public:
+    explicit DfsUploader(ExtraChainNode *node, QObject *parent = nullptr);
+
+    bool addFile(const std::filesystem::path &file);
+    bool scan(const std::filesystem::path &dir);
+    void setConcurrency(int value);
+    void setIdleTimeout(int seconds);
+    void start();
+
+signals:
+    void finished(qint64 uploaded, qint64 failed);
+
+private:
+    struct File {
+        std::filesystem::path path;
+        qint64                size = 0;
+    };
+
+    struct Upload {
+        File   file;
+        qint64 lastActivity = 0;
+    };
+
+    void startNext();
+    void readAhead();
+    void fileUploaded(const std::string &fileId);
+    void countUploaded(const File &file);
+    void checkIdle();
+    void finish();
+
+    ExtraChainNode        *node;
+    ActorId                owner;
+    std::deque<File>       queue;
+    QHash<QString, Upload> uploads;
+    std::set<std::string>  uploadedEarly; // reported while store_file was still running
+    bool                   storing = false;
+    std::future<void>      prefetch;
+    QTimer                 idleTimer;
+    QElapsedTimer          timer;
+    qint64                 totalFiles    = 0;
+    qint64                 totalBytes    = 0;
+    qint64                 uploadedBytes = 0;
+    qint64                 uploadedFiles = 0;
+    qint64                 failedFiles   = 0;
+    qint64                 idleTimeoutMs = 120000;
+    int                    concurrency   = 4;
+    size_t                 readAheadDone = 0;
+};
+
+#endif // DFSUPLOADER_H
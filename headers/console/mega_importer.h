@@ -0,0 +1,90 @@
+/*
+ * ExtraChain Console Client
+ * Copyright (C) 2025 ExtraChain Foundation <official@extrachain.io>
+ *
+ * This library is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef MEGAIMPORTER_H
+#define MEGAIMPORTER_H
+
+#include <QElapsedTimer>
+#include <QFile>
+#include <QObject>
+
+#include <functional>
+#include <future>
+
+#include "managers/extrachain_node.h"
+#include "utils/db_connector.h"
+
+// Streams GenesisDataRow entries of console-data/0 into the DAG. Rows are read in
+// chunks; the next chunk is signed on worker threads while the current one is saved.
+// Every saved row is appended to a journal and the journal is folded into the
+// checkpoint after each chunk, so a resumed import never signs a saved row again.
+class MegaImporter : public QObject {
+    Q_OBJECT
+
+public:
+    explicit MegaImporter(ExtraChainNode *node, QObject *parent = nullptr);
+
+    void setChunkSize(qint64 size);
+    void setResume(bool value);
+    bool start();
+
+    static inline const QString checkpointFile = "mega-import.checkpoint";
+    static inline const QString journalFile    = "mega-import.journal";
+
+signals:
+    void finished(bool success);
+
+private:
+    struct GenesisRow {
+        qint64      rowid = 0;
+        std::string actorId;
+        std::string state;
+        std::string token;
+    };
+
+    struct SignedChunk {
+        std::vector<Transaction> transactions;
+        std::vector<qint64>      rowids;
+        qint64                   lastRowid   = 0;
+        qint64                   failedRowid = 0;
+    };
+
+    std::vector<GenesisRow> readChunk();
+    SignedChunk             signChunk(const std::vector<GenesisRow> &rows) const;
+    void                    prefetch();
+    void                    step();
+    void                    finish(bool success);
+    bool                    loadCheckpoint();
+    void                    saveCheckpoint(qint64 rowid, bool done);
+
+    ExtraChainNode                    *node;
+    DbConnector                        db;
+    Transaction                        txTemplate;
+    std::function<bool(Transaction &)> sign;
+    std::future<SignedChunk>           pending;
+    QFile                              journal;
+    QElapsedTimer                      timer;
+    qint64                             chunkSize     = 10000;
+    qint64                             lastReadRowid = 0;
+    qint64                             total         = 0;
+    qint64                             imported      = 0;
+    bool                               resume        = false;
+};
+
+#endif // MEGAIMPORTER_H
@@ -0,0 +1,43 @@
+/*
+ * ExtraChain Console Client
+ * Copyright (C) 2025 ExtraChain Foundation <official@extrachain.io>
+ *
+ * This library is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef NETWORKPROTOCOL_H
+#define NETWORKPROTOCOL_H
+
+#include <QString>
+
+#include <optional>
+
+#include "network/network_manager.h"
+
+// Console names of the transports accepted by connectToNode.
+inline std::optional<Network::Protocol> parseProtocol(const QString &name) {
+    const QString value = name.toLower();
+    if (value == "ws" || value == "websocket")
+        return Network::Protocol::WebSocket;
+    if (value == "udp")
+        return Network::Protocol::Udp;
+    return std::nullopt;
+}
+
+inline QString protocolName(Network::Protocol protocol) {
+    return protocol == Network::Protocol::Udp ? "udp" : "ws";
+}
+
+#endif // NETWORKPROTOCOL_H
@@ -0,0 +1,84 @@
+/*
+ * ExtraChain Console Client
+ * Copyright (C) 2025 ExtraChain Foundation <official@extrachain.io>
+ *
+ * This library is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef NOTIFICATIONCOALESCER_H
+#define NOTIFICATIONCOALESCER_H
+
+#include <QElapsedTimer>
+#include <QHash>
+#include <QObject>
+#include <QTimer>
+
+#include <deque>
+
+#include "utils/exc_utils.h"
+
+// Buffers notifications per actor for a short window and merges events of the same
+// type, so a burst of chain events turns into one push per type with a count.
+// Flushes are limited per actor and globally with token buckets; actors take turns
+// on the global bucket, and limited actors keep accumulating until they may send again.
+class NotificationCoalescer : public QObject {
+    Q_OBJECT
+
+public:
+    static constexpr qint64 window         = 2000; // ms an actor's first event waits for more
+    static constexpr int    tickInterval   = 100;  // ms
+    static constexpr double actorRate      = 0.1;  // pushes per second per actor
+    static constexpr double actorBurst     = 3;
+    static constexpr double globalRate     = 50;   // pushes per second overall
+    static constexpr double globalBurst    = 100;
+    static constexpr int    maxIdleBuckets = 10000;
+
+    explicit NotificationCoalescer(QObject *parent = nullptr);
+
+public slots:
+    void add(QString actorId, Notification notification);
+
+signals:
+    void ready(QString actorId, Notification notification, int count);
+
+private:
+    struct Bucket {
+        double tokens    = 0;
+        qint64 updatedAt = 0;
+
+        void refill(double rate, double burst, qint64 now);
+    };
+
+    struct Pending {
+        Notification latest;
+        int          count = 0;
+    };
+
+    struct ActorQueue {
+        qint64              firstAt = 0;
+        QHash<int, Pending> byType;
+    };
+
+    void tick();
+
+    QHash<QString, ActorQueue> queues;
+    std::deque<QString>        order; // actors with queued notifications, next turn first
+    QHash<QString, Bucket>     actorBuckets;
+    Bucket                     globalBucket;
+    QElapsedTimer              clock;
+    QTimer                     timer;
+};
+
+#endif // NOTIFICATIONCOALESCER_H
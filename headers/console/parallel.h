@@ -0,0 +1,102 @@
+/*
+ * ExtraChain Console Client
+ * Copyright (C) 2025 ExtraChain Foundation <official@extrachain.io>
+ *
+ * This library is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include <QSemaphore>
+#include <QThread>
+#include <QThreadPool>
+
+#include <algorithm>
+#include <atomic>
+#include <future>
+#include <memory>
+#include <type_traits>
+
+// Threading in the console.
+//
+// The node's state (DAG, DFS, account controller, network and their databases) makes
+// no thread-safety promises, so it is only touched on the node's thread. Work handed
+// to other threads is self-contained: parsing, file IO, and crypto on values the task
+// owns or nobody writes to, such as signing a transaction it built or decrypting with
+// a copy of a key. Those calls end up in libsodium and share no state.
+//
+// Such work runs on QThreadPool::globalInstance(), through parallelFor for loops and
+// runInPool for a single background job. Blocking file copies use a QThreadPool of
+// their own so they don't hold the global workers.
+
+inline size_t workerCount() {
+    return static_cast<size_t>(std::max(1, QThread::idealThreadCount()));
+}
+
+// Runs fn on the global pool, the result is delivered through the future.
+template <typename Fn>
+auto runInPool(Fn &&fn) -> std::future<std::invoke_result_t<std::decay_t<Fn>>> {
+    using Result = std::invoke_result_t<std::decay_t<Fn>>;
+    auto task    = std::make_shared<std::packaged_task<Result()>>(std::forward<Fn>(fn));
+    auto future  = task->get_future();
+    QThreadPool::globalInstance()->start([task] {
+        (*task)();
+    });
+    return future;
+}
+
+// Calls fn(index) for every index in [0, count) and blocks until all of them are done.
+// Indexes are handed out in blocks of grain. The calling thread takes part, and helpers
+// only join when the global pool has an idle thread, so a parallelFor inside a pool
+// task never waits on work that can't start.
+template <typename Fn>
+void parallelFor(size_t count, Fn &&fn, size_t grain = 64) {
+    grain                = std::max<size_t>(grain, 1);
+    const size_t threads = std::min(workerCount(), (count + grain - 1) / grain);
+    if (threads <= 1) {
+        for (size_t i = 0; i < count; ++i)
+            fn(i);
+        return;
+    }
+
+    std::atomic<size_t> next = 0;
+    auto                worker = [&] {
+        for (;;) {
+            const size_t begin = next.fetch_add(grain);
+            if (begin >= count)
+                return;
+            const size_t end = std::min(count, begin + grain);
+            for (size_t i = begin; i < end; ++i)
+                fn(i);
+        }
+    };
+
+    QSemaphore done;
+    int        helpers = 0;
+    for (size_t i = 1; i < threads; ++i) {
+        const bool started = QThreadPool::globalInstance()->tryStart([&] {
+            worker();
+            done.release();
+        });
+        if (!started)
+            break;
+        ++helpers;
+    }
+    worker();
+    done.acquire(helpers);
+}
+
+#endif // PARALLEL_H
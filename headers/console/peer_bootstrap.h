@@ -0,0 +1,87 @@
+/*
+ * ExtraChain Console Client
+ * Copyright (C) 2025 ExtraChain Foundation <official@extrachain.io>
+ *
+ * This library is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef PEERBOOTSTRAP_H
+#define PEERBOOTSTRAP_H
+
+#include <QElapsedTimer>
+#include <QObject>
+#include <QSet>
+#include <QTimer>
+
+#include <deque>
+#include <vector>
+
+#include "managers/extrachain_node.h"
+#include "network/network_manager.h"
+
+// Dials peers from a seed list. Up to window dials are in flight; a dial counts as
+// done when the peer shows up as an active connection, or fails after the timeout.
+// The first keep peers to answer are reported as the fastest; once they are in, no
+// more seeds are dialled and the dials in flight are no longer waited for. The
+// network manager has no way to close a connection or cancel a dial, so slower and
+// late answers stay connected. Seeds that are already connected are not dialled.
+class PeerBootstrap : public QObject {
+    Q_OBJECT
+
+public:
+    struct Peer {
+        QString ip;
+        qint64  latencyMs = 0;
+    };
+
+    explicit PeerBootstrap(ExtraChainNode *node, QObject *parent = nullptr);
+
+    bool loadFile(const QString &path);
+    void setWindow(int value);
+    void setTimeout(int ms);
+    void setKeep(int value);
+    void setProtocol(Network::Protocol value);
+    void start();
+
+signals:
+    void finished(int connected);
+
+private:
+    struct Dial {
+        QString ip;
+        qint64  startedMs = 0;
+    };
+
+    QSet<QString> activePeers() const;
+    void          dialNext();
+    void          poll();
+    void          finish();
+
+    ExtraChainNode     *node;
+    std::deque<QString> seeds;
+    std::vector<Dial>   dials;
+    std::vector<Peer>   peers;
+    QTimer              pollTimer;
+    QElapsedTimer       timer;
+    int                 window     = 16;
+    int                 timeoutMs  = 5000;
+    int                 keep       = 8;
+    int                 failed     = 0;
+    int                 late       = 0;
+    int                 unanswered = 0;
+    Network::Protocol   protocol   = Network::Protocol::WebSocket;
+};
+
+#endif // PEERBOOTSTRAP_H
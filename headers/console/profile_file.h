@@ -0,0 +1,36 @@
+/*
+ * ExtraChain Console Client
+ * Copyright (C) 2025 ExtraChain Foundation <official@extrachain.io>
+ *
+ * This library is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef PROFILEFILE_H
+#define PROFILEFILE_H
+
+#include <QString>
+
+#include <optional>
+#include <string>
+
+// Profile export files. Writes go through QSaveFile so a crash never leaves a
+// half-written profile; reads map the file instead of buffering it twice.
+// Compressed files start with the "EXCZ" magic followed by qCompress output.
+namespace ProfileFile {
+bool                       write(const QString &path, const std::string &data, bool compress);
+std::optional<std::string> read(const QString &path);
+}
+
+#endif // PROFILEFILE_H
@@ -0,0 +1,70 @@
+/*
+ * ExtraChain Console Client
+ * Copyright (C) 2025 ExtraChain Foundation <official@extrachain.io>
+ *
+ * This library is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef PUSHBROADCAST_H
+#define PUSHBROADCAST_H
+
+#include <QElapsedTimer>
+#include <QObject>
+
+#include <functional>
+
+#include "console/push_token_store.h"
+
+// Sends one notification to every stored push token without blocking the event
+// loop: tokens are read page by page on the main thread, decoded with parallelFor
+// off the event loop, and handed to the sender when a page comes back. Only one page
+// is decoded at a time, so memory stays bounded by the page size. Pool tasks hold
+// their own copy of the decoder, so deleting the broadcast only drops the page.
+class PushBroadcast : public QObject {
+    Q_OBJECT
+
+public:
+    using Decoder = std::function<bool(PushToken &)>;       // worker threads, false skips the token
+    using Sender  = std::function<void(const PushToken &)>; // main thread
+
+    struct Stats {
+        qint64 pages   = 0;
+        qint64 tokens  = 0;
+        qint64 queued  = 0;
+        qint64 skipped = 0;
+        qint64 ms      = 0;
+    };
+
+    PushBroadcast(PushTokenStore *store, Decoder decoder, Sender sender, QObject *parent = nullptr);
+
+    void start(int pageSize = 1000);
+
+signals:
+    void finished(PushBroadcast::Stats stats);
+
+private:
+    void readPage();
+    void decoded(std::vector<PushToken> tokens, std::vector<char> valid);
+
+    PushTokenStore *store;
+    Decoder         decoder;
+    Sender          sender;
+    Stats           stats;
+    QElapsedTimer   timer;
+    qint64          rowid    = 0;
+    int             pageSize = 1000;
+};
+
+#endif // PUSHBROADCAST_H
@@ -0,0 +1,98 @@
+/*
+ * ExtraChain Console Client
+ * Copyright (C) 2025 ExtraChain Foundation <official@extrachain.io>
+ *
+ * This library is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef PUSHDELIVERYQUEUE_H
+#define PUSHDELIVERYQUEUE_H
+
+#include <QHash>
+#include <QJsonObject>
+#include <QNetworkAccessManager>
+#include <QNetworkReply>
+#include <QTimer>
+
+#include <deque>
+
+// Coalesces push messages per push server into batched POST requests.
+//
+// Request:  POST <server>batch  {"notifications": [{"os", "token", "message", "data"}, ...]}
+// Response: {"results": [{"token", "errorType", "errorText"}, ...]}
+//
+// Network errors, HTTP 429/5xx, per-token "ConnectionError" results and tokens the
+// response doesn't mention are retried with exponential backoff; other HTTP errors
+// drop the batch, a resend would fail the same way. "BadDeviceToken"/"Unregistered"
+// tokens are reported through tokenRejected() so the owner can prune them. Requests
+// are spread over several QNetworkAccessManager shards, each with its own connection pool
+// and at most maxInFlight requests; a batch goes to the next shard with a free slot.
+class PushDeliveryQueue : public QObject {
+    Q_OBJECT
+
+public:
+    struct Message {
+        std::string actorKey;
+        QString     token;
+        QJsonObject payload;
+    };
+
+    struct Stats {
+        qint64 sent     = 0;
+        qint64 rejected = 0;
+        qint64 failed   = 0; // answered with an error that is neither retried nor a bad token
+        qint64 dropped  = 0;
+        qint64 retried  = 0;
+    };
+
+    static constexpr int batchSize     = 500;
+    static constexpr int maxInFlight   = 8; // per shard
+    static constexpr int maxAttempts   = 5;
+    static constexpr int flushInterval = 50;   // ms
+    static constexpr int retryDelay    = 1000; // ms, doubled on every attempt
+
+    explicit PushDeliveryQueue(QObject *parent = nullptr);
+
+    void  enqueue(const QString &server, Message message);
+    void  setShards(int count);
+    Stats stats() const;
+
+signals:
+    void tokenRejected(std::string actorKey, QString token);
+
+private:
+    struct Batch {
+        QString              server;
+        std::vector<Message> messages;
+        int                  attempt = 0;
+    };
+
+    void flush();
+    int  freeShard();
+    void sendNext();
+    void send(int shard, Batch batch);
+    void resolve(QNetworkReply *reply, Batch batch);
+    void retry(Batch batch);
+
+    std::vector<QNetworkAccessManager *> managers;
+    QHash<QString, std::vector<Message>> collecting; // per server, until the next flush
+    std::deque<Batch>                    ready;
+    QTimer                               flushTimer;
+    std::vector<int>                     inFlight; // per shard
+    Stats                                counters;
+    size_t                               nextShard = 0;
+};
+
+#endif // PUSHDELIVERYQUEUE_H
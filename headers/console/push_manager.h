@@ -20,14 +20,14 @@
 #ifndef PUSHMANAGER_H
 #define PUSHMANAGER_H
 
-#include <QNetworkAccessManager>
-#include <QNetworkReply>
-
+#include "console/push_delivery_queue.h"
+#include "console/push_token_store.h"
 #include "managers/account_controller.h"
 #include "utils/db_connector.h"
 #include "utils/exc_utils.h"
 
 class ExtraChainNode;
+class NotificationCoalescer;
 
 class PushManager : public QObject {
     Q_OBJECT
@@ -40,17 +40,27 @@ public:
 public slots:
     void pushNotification(QString actorId, Notification notification);
     void saveNotificationToken(QByteArray os, ActorId actorId, ActorId token);
-    void responseResolver(QNetworkReply *reply);
     void chatMessage(QString sender, QString msgPath);
     //    void fileAdded(QString path, QString original, DfsStruct::Type type, QString actorId);
 
 private:
-    void    sendNotification(const QString &token, const QString &os, const Notification &notification);
+    bool    openTokenStore(bool create);
+    void    deliver(QString actorId, Notification notification, int count);
+    void    sendNotification(const PushToken    &token,
+                             const QString      &os,
+                             const Notification &notification,
+                             int                 count);
     QString notificationToMessage(const Notification &notification);
+    QString summaryMessage(const Notification &notification, int count);
+
+    static constexpr int broadcastPageSize = 1000;
+    static constexpr int deliveryShards    = 4;
 
     const QString          pushServerUrl = "http://127.0.0.1:8000/";
-    QNetworkAccessManager *manager;
-    ExtraChainNode        *node;
+    PushDeliveryQueue     *deliveryQueue;
+    NotificationCoalescer *coalescer;
+    ExtraChainNode        *node = nullptr;
+    PushTokenStore         tokenStore;
 };
 
 #endif // PUSHMANAGER_H
@@ -0,0 +1,86 @@
+/*
+ * ExtraChain Console Client
+ * Copyright (C) 2025 ExtraChain Foundation <official@extrachain.io>
+ *
+ * This library is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef PUSHTOKENSTORE_H
+#define PUSHTOKENSTORE_H
+
+#include <QByteArray>
+#include <QCache>
+#include <QString>
+
+#include <string>
+#include <vector>
+
+struct sqlite3;
+struct sqlite3_stmt;
+
+// token and os are kept as the node sealed them with encrypt_self, the reader decodes them
+struct PushToken {
+    std::string actorKey;
+    std::string token;
+    std::string os;
+};
+
+// Long-lived store of push tokens. Keeps one open connection to the "notification"
+// database with prepared statements and indexes tokens by a keyed hash of the actor
+// id, derived from the node's secret key, so a lookup needs neither an encryption nor
+// a table scan and the index is useless without the key. Recent lookups are kept in
+// an LRU cache.
+class PushTokenStore {
+public:
+    static constexpr int cacheSize = 4096;
+
+    explicit PushTokenStore(const std::string &name = "notification");
+    ~PushTokenStore();
+
+    bool open(bool create, const QByteArray &secretKey);
+    bool isOpen() const;
+
+    std::string            actorKey(const std::string &actorId) const;
+    std::vector<PushToken> tokens(const std::string &actorId);
+    // token is the plain device token, sealedToken and sealedOs are encrypted by the node
+    void save(const std::string &actorId,
+              const std::string &token,
+              const std::string &sealedToken,
+              const std::string &sealedOs);
+    void remove(const std::string &actorKey, const std::string &token);
+
+    // Pages through all tokens in rowid order, afterRowid is the last rowid already seen.
+    std::vector<PushToken> page(qint64 &afterRowid, int limit);
+
+private:
+    enum Statement {
+        SelectTokens,
+        InsertToken,
+        DeleteToken,
+        PageTokens,
+        StatementCount
+    };
+
+    std::string keyedHash(const std::string &message) const;
+    bool        step(Statement statement);
+
+    std::string                             name;
+    sqlite3                                *db = nullptr;
+    sqlite3_stmt                           *statements[StatementCount] = {};
+    QByteArray                              indexKey;
+    QCache<QString, std::vector<PushToken>> cache;
+};
+
+#endif // PUSHTOKENSTORE_H
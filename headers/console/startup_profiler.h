@@ -0,0 +1,55 @@
+/*
+ * ExtraChain Console Client
+ * Copyright (C) 2025 ExtraChain Foundation <official@extrachain.io>
+ *
+ * This library is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef STARTUPPROFILER_H
+#define STARTUPPROFILER_H
+
+#include <QElapsedTimer>
+#include <QString>
+
+#include <vector>
+
+// Records consecutive startup phases. begin() closes the running phase and opens
+// the next one, so instrumenting a step is a single line before it.
+class StartupProfiler {
+public:
+    struct Phase {
+        QString name;
+        qint64  startMs    = 0;
+        qint64  durationMs = 0;
+    };
+
+    StartupProfiler();
+
+    void begin(const QString &name);
+    void end();
+
+    qint64                    elapsed() const;
+    const std::vector<Phase> &phases() const;
+
+    void print() const;
+    bool save(const QString &path) const;
+
+private:
+    QElapsedTimer      timer;
+    std::vector<Phase> list;
+    bool               running = false;
+};
+
+#endif // STARTUPPROFILER_H
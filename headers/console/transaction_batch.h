@@ -0,0 +1,66 @@
+/*
+ * ExtraChain Console Client
+ * Copyright (C) 2025 ExtraChain Foundation <official@extrachain.io>
+ *
+ * This library is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef TRANSACTIONBATCH_H
+#define TRANSACTIONBATCH_H
+
+#include <QElapsedTimer>
+#include <QObject>
+
+#include <optional>
+#include <string_view>
+
+#include "managers/extrachain_node.h"
+
+// Submits transactions from a "receiver,amount[,token]" CSV file. Lines are parsed
+// on worker threads into ready Transaction objects, then handed to send_transaction
+// at most chunkSize per event-loop turn so a large payout never blocks the node.
+class TransactionBatch : public QObject {
+    Q_OBJECT
+
+public:
+    explicit TransactionBatch(ExtraChainNode *node, QObject *parent = nullptr);
+
+    bool load(const QString &path);
+    void setChunkSize(int size);
+    void start();
+
+    static Transaction makeTransaction(const ActorId                &sender,
+                                       const ActorId                &receiver,
+                                       const BigNumberFloat         &amount,
+                                       const std::optional<ActorId> &token = std::nullopt);
+    static bool        isActorId(std::string_view value);
+    static bool        isAmount(std::string_view value);
+
+signals:
+    void finished(qint64 accepted, qint64 rejected);
+
+private:
+    void submitNext();
+
+    ExtraChainNode          *node;
+    std::vector<Transaction> transactions;
+    size_t                   next      = 0;
+    int                      chunkSize = 256;
+    qint64                   accepted  = 0;
+    qint64                   rejected  = 0;
+    QElapsedTimer            timer;
+};
+
+#endif // TRANSACTIONBATCH_H
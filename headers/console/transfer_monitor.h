@@ -0,0 +1,89 @@
+/*
+ * ExtraChain Console Client
+ * Copyright (C) 2025 ExtraChain Foundation <official@extrachain.io>
+ *
+ * This library is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef TRANSFERMONITOR_H
+#define TRANSFERMONITOR_H
+
+#include <QElapsedTimer>
+#include <QObject>
+#include <QTimer>
+
+#include <array>
+#include <string>
+#include <unordered_map>
+
+// Aggregates DFS transfer progress signals. Updates only touch a small per-file
+// entry keyed by owner and DFS file id (or the target path for exports); a timer
+// writes one summary through the logger at most every logInterval ms, so bursts of
+// progress signals cost a hash lookup each instead of a formatted log line.
+class TransferMonitor : public QObject {
+    Q_OBJECT
+
+public:
+    enum class Direction : quint8 {
+        Upload,
+        Download,
+        Export
+    };
+
+    // file ids are only unique per owner, exports leave the owner empty and use the target path as id
+    struct Key {
+        std::string owner;
+        std::string id;
+
+        bool operator==(const Key &other) const = default;
+    };
+
+    static constexpr int logInterval = 2000; // ms
+
+    explicit TransferMonitor(QObject *parent = nullptr);
+
+    // progress in percent, used by DfsController signals
+    void update(Direction direction, const Key &key, int percent);
+    // progress in bytes, used by local exports
+    void update(Direction direction, const Key &key, qint64 done, qint64 total);
+    void remove(Direction direction, const Key &key);
+
+private:
+    struct Transfer {
+        qint64 startedAt = 0; // ms since monitor start
+        qint64 updatedAt = 0;
+        qint64 done      = 0; // bytes, or percent * 100 when total is unknown
+        qint64 total     = 0;
+        double rate      = 0; // smoothed units per second
+    };
+    struct KeyHash {
+        size_t operator()(const Key &key) const {
+            const size_t owner = std::hash<std::string>()(key.owner);
+            return owner ^ (std::hash<std::string>()(key.id) + 0x9e3779b9 + (owner << 6) + (owner >> 2));
+        }
+    };
+    using Transfers = std::unordered_map<Key, Transfer, KeyHash>;
+
+    void    flush();
+    bool    empty() const;
+    QString summary(Direction direction) const;
+
+    std::array<Transfers, 3> transfers;
+    QElapsedTimer            clock;
+    QTimer                   timer;
+    bool                     dirty = false;
+};
+
+#endif // TRANSFERMONITOR_H
@@ -0,0 +1,65 @@
+/*
+ * ExtraChain Console Client
+ * Copyright (C) 2025 ExtraChain Foundation <official@extrachain.io>
+ *
+ * This library is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef TXBENCHMARK_H
+#define TXBENCHMARK_H
+
+#include <QElapsedTimer>
+#include <QJsonObject>
+#include <QObject>
+#include <QTimer>
+
+#include <optional>
+
+#include "managers/extrachain_node.h"
+
+// Transaction load generator. Builds transactions like the "transaction" command
+// and submits them at a target rate (0 = as fast as possible), then reports
+// sustained TPS of accepted transactions and submit latency percentiles as JSON.
+class TxBenchmark : public QObject {
+    Q_OBJECT
+
+public:
+    explicit TxBenchmark(ExtraChainNode *node, QObject *parent = nullptr);
+
+    void setCount(qint64 value);
+    void setRate(qint64 value);
+    void setReceiver(const ActorId &value);
+    void start();
+
+signals:
+    void finished(QJsonObject result);
+
+private:
+    void        tick();
+    QJsonObject report() const;
+
+    ExtraChainNode        *node;
+    std::optional<ActorId> receiver;
+    qint64                 count    = 1000;
+    qint64                 rate     = 0;
+    qint64                 sent     = 0;
+    qint64                 accepted = 0; // send_transaction succeeded, only these count towards TPS
+    qint64                 rejected = 0;
+    std::vector<qint64>    latencies; // ns spent in send_transaction
+    QElapsedTimer          timer;
+    QTimer                 ticker;
+};
+
+#endif // TXBENCHMARK_H
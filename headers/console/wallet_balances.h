@@ -0,0 +1,54 @@
+/*
+ * ExtraChain Console Client
+ * Copyright (C) 2025 ExtraChain Foundation <official@extrachain.io>
+ *
+ * This library is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef WALLETBALANCES_H
+#define WALLETBALANCES_H
+
+#include <QHash>
+#include <QString>
+
+#include <optional>
+#include <vector>
+
+#include "managers/extrachain_node.h"
+
+// Balance lookups for "wallet balance". Results are kept until the dag moves to
+// another section or a transaction of the actor is sent or saved, so repeated
+// queries in between do not touch the dag at all.
+class WalletBalances {
+public:
+    struct Entry {
+        QString label;
+        QString actorId;
+        QString balance;
+    };
+
+    std::vector<Entry> query(ExtraChainNode *node, const std::vector<std::pair<QString, ActorId>> &actors);
+    void               invalidate(const QString &actorId);
+    void               clear();
+
+    static void       printTable(const std::vector<Entry> &entries);
+    static QByteArray toJson(const std::vector<Entry> &entries);
+
+private:
+    std::optional<SectionId> section;
+    QHash<QString, QString>  cache;
+};
+
+#endif // WALLETBALANCES_H
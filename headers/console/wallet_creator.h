@@ -0,0 +1,62 @@
+/*
+ * ExtraChain Console Client
+ * Copyright (C) 2025 ExtraChain Foundation <official@extrachain.io>
+ *
+ * This library is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef WALLETCREATOR_H
+#define WALLETCREATOR_H
+
+#include <QElapsedTimer>
+#include <QObject>
+#include <QStringList>
+
+#include "managers/extrachain_node.h"
+
+// Creates wallets in bulk for "wallet new <count>". Wallets are created a chunk per
+// event loop iteration so the console stays responsive, and creation stops at the
+// first wallet the account controller can't create. The new ids can be written to
+// a file in one atomic write at the end; a relative path is resolved against the
+// data directory, where the console runs.
+class WalletCreator : public QObject {
+    Q_OBJECT
+
+public:
+    static constexpr qint64 chunkSize = 64;
+
+    explicit WalletCreator(ExtraChainNode *node, QObject *parent = nullptr);
+
+    void setCount(qint64 value);
+    void setOutput(const QString &path);
+    void start();
+
+signals:
+    void finished(qint64 created, bool success);
+
+private:
+    void step();
+    void finish();
+
+    ExtraChainNode *node;
+    QString         output;
+    QStringList     ids;
+    QElapsedTimer   timer;
+    qint64          count        = 1;
+    qint64          lastReported = 0;
+    bool            failed       = false;
+};
+
+#endif // WALLETCREATOR_H
@@ -21,15 +21,25 @@
 #include <QCoreApplication>
 #include <QDir>
 #include <QElapsedTimer>
+#include <QFileInfo>
 #include <QLockFile>
 #include <QStandardPaths>
+#include <QTimer>
 
 #include <csignal>
 
 #include "dfs/dfs_controller.h"
 #include "extrachain_version.h"
 #include "utils/exc_utils.h"
+#include "console/balance_cleaner.h"
+#include "console/batch_runner.h"
 #include "console/console_manager.h"
+#include "console/mega_importer.h"
+#include "console/network_protocol.h"
+#include "console/peer_bootstrap.h"
+#include "console/profile_file.h"
+#include "console/startup_profiler.h"
+#include "console/tx_benchmark.h"
 #include "managers/extrachain_node.h"
 #include "managers/logs_manager.h"
 #include "utils/exc_logs.h"
@@ -167,8 +177,11 @@ bool SetupSignals() {
 }
 
 int main(int argc, char* argv[]) {
+    StartupProfiler profiler;
+    profiler.begin("prepare");
     Utils::prepare_extrachain();
 
+    profiler.begin("application");
     QCoreApplication app(argc, argv);
 
     app.setApplicationName("ExtraChain Console Client");
@@ -181,6 +194,7 @@ int main(int argc, char* argv[]) {
 
     registerMetaTypes();
 
+    profiler.begin("lock file");
 #if !defined(Q_OS_ANDROID) && !defined(Q_OS_IOS)
     static QLockFile lockFile(".extrachain-console.lock");
     if (!lockFile.tryLock(100)) {
@@ -189,6 +203,7 @@ int main(int argc, char* argv[]) {
     }
 #endif
 
+    profiler.begin("arguments");
     QCommandLineParser parser;
     parser.setApplicationDescription(
         "ExtraChain (ExC) is a lightweight blockchain infrastructure and decentralized storage ExDFS "
@@ -217,10 +232,27 @@ int main(int argc, char* argv[]) {
     QCommandLineOption chatOption("create-chat-templates", "Create chat templates from network id");
     QCommandLineOption renamesOption("create-renames-template", "Create renames template");
     QCommandLineOption megaImportOption("import-from-mega", "Import from console-data/0 file");
+    QCommandLineOption megaChunkOption("import-chunk", "Rows per chunk for --import-from-mega", "rows");
+    QCommandLineOption megaResumeOption("import-resume", "Resume --import-from-mega from the last checkpoint");
     QCommandLineOption clearBalance("clear-balance", "Clear txs with balance < 0");
+    QCommandLineOption clearBalanceChunk("clear-balance-chunk", "Actors per chunk for --clear-balance", "actors");
     QCommandLineOption dagMode("dag-mode", "Choose dag mode: full / light", "mode");
     QCommandLineOption dfsMode("dfs-mode", "Choose dfs mode: full / light", "mode");
     QCommandLineOption regenControls("regen-controls", "Regerarate controls");
+    QCommandLineOption benchTxOption("bench-tx", "Run transaction benchmark and exit", "count");
+    QCommandLineOption benchRateOption("bench-rate", "Target rate for --bench-tx, tx/s", "rate");
+    QCommandLineOption protocolOption("protocol", "Transport for connect file and --seeds: ws / udp", "protocol");
+    QCommandLineOption seedsOption("seeds", "Dial peers listed in file on startup", "file");
+    QCommandLineOption seedsKeepOption("seeds-keep", "Fastest peers to wait for from --seeds, default 8", "count");
+    QCommandLineOption seedsTimeoutOption("seeds-timeout", "Per-peer dial timeout for --seeds, ms", "ms");
+    QCommandLineOption execFileOption("exec-file",
+                                      "Run console commands from file and exit, - reads stdin until EOF",
+                                      "file");
+    QCommandLineOption execTimeoutOption("exec-timeout",
+                                         "Seconds to wait for asynchronous batch commands, default 600",
+                                         "seconds");
+    QCommandLineOption startupReportOption("startup-report",
+                                           "Print startup phase timings and save startup-report.json");
 
     parser.addOptions({ debugLogsOption,
                         dirOption,
@@ -240,13 +272,33 @@ int main(int argc, char* argv[]) {
                         subscriptionOption,
                         chatOption,
                         megaImportOption,
+                        megaChunkOption,
+                        megaResumeOption,
                         clearBalance,
+                        clearBalanceChunk,
                         dagMode,
                         dfsMode,
                         regenControls,
+                        protocolOption,
+                        seedsOption,
+                        seedsKeepOption,
+                        seedsTimeoutOption,
+                        execFileOption,
+                        execTimeoutOption,
+                        benchTxOption,
+                        benchRateOption,
+                        startupReportOption,
                         renamesOption });
     parser.process(app);
 
+    // resolved before the working directory moves into the data directory
+    QString execFile = parser.value(execFileOption);
+    if (!execFile.isEmpty() && execFile != "-")
+        execFile = QFileInfo(execFile).absoluteFilePath();
+    QString seedsFile =
+        parser.isSet(seedsOption) ? QFileInfo(parser.value(seedsOption)).absoluteFilePath() : QString();
+
+    profiler.begin("data directory");
     // TODO: allow absolute directory
     QString dirName = Utils::fixFileName(parser.value(dirOption), "");
     Utils::dataDir(dirName.isEmpty() ? "console-data" : dirName);
@@ -273,6 +325,7 @@ int main(int argc, char* argv[]) {
     //        return -1;
     //    }
 
+    profiler.begin("logger");
     LogsManager::debugLogs = parser.isSet(debugLogsOption);
 #ifdef QT_DEBUG
     LogsManager::debugLogs = !parser.isSet(debugLogsOption);
@@ -306,8 +359,14 @@ int main(int argc, char* argv[]) {
     if (LogsManager::debugLogs)
         LogsManager::print("");
 
+    profiler.begin("credentials");
     QString argEmail    = parser.value(emailOption);
     QString argPassword = parser.value(passOption);
+    if (execFile == "-" && (argEmail.isEmpty() || argPassword.isEmpty()) && !AutologinHash::isAvailable()) {
+        // the prompt would read the credentials from the command stream
+        eInfo("--exec-file - needs --login and --password");
+        std::exit(-1);
+    }
     QString email =
         argEmail.isEmpty() && !AutologinHash::isAvailable() ? ConsoleManager::getSomething("e-mail") : argEmail;
     QString password = argPassword.isEmpty() && !AutologinHash::isAvailable()
@@ -315,14 +374,68 @@ int main(int argc, char* argv[]) {
                            : argPassword;
     if (argEmail.isEmpty() || argPassword.isEmpty())
         LogsManager::print("");
-    if (parser.isSet(inputOption))
+
+    // commands from --exec-file run once the node is initialised
+    BatchRunner* batch = nullptr;
+    if (!execFile.isEmpty()) {
+        batch = new BatchRunner(&console, &app);
+        batch->setTimeout(parser.value(execTimeoutOption).toInt());
+        bool loaded = execFile == "-" ? batch->loadStdin() : batch->loadFile(execFile);
+        if (!loaded)
+            std::exit(-1);
+
+        QObject::connect(batch, &BatchRunner::finished, [](bool success) {
+            qApp->exit(success ? 0 : 1);
+        });
+    }
+
+    if (parser.isSet(inputOption) || batch != nullptr)
         eLog("[Console] Input off");
     else
         console.startInput();
 
+    // modes are validated before the node starts, so a typo fails fast instead of running a full node
+    const QString dagModeStr = parser.value(dagMode).toLower();
+    const QString dfsModeStr = parser.value(dfsMode).toLower();
+    for (const auto& mode : { dagModeStr, dfsModeStr }) {
+        if (!mode.isEmpty() && mode != "full" && mode != "light") {
+            eInfo("Unknown mode {}, expected full / light", mode);
+            std::exit(-1);
+        }
+    }
+    const DagMode dagModeValue = dagModeStr == "light" ? DagMode::Light : DagMode::Full;
+    const DfsMode dfsModeValue = dfsModeStr == "light" ? DfsMode::Light : DfsMode::Full;
+
+    const auto protocol = parseProtocol(parser.isSet(protocolOption) ? parser.value(protocolOption) : "ws");
+    if (!protocol.has_value()) {
+        eInfo("Unknown protocol {}, expected ws / udp", parser.value(protocolOption));
+        std::exit(-1);
+    }
+    console.setProtocol(*protocol);
+
+    qint64 benchCount = 0;
+    qint64 benchRate  = 0;
+    if (parser.isSet(benchTxOption)) {
+        bool isOk  = false;
+        benchCount = parser.value(benchTxOption).toLongLong(&isOk);
+        if (!isOk || benchCount <= 0) {
+            eInfo("Invalid --bench-tx count {}", parser.value(benchTxOption));
+            std::exit(-1);
+        }
+        if (parser.isSet(benchRateOption)) {
+            benchRate = parser.value(benchRateOption).toLongLong(&isOk);
+            if (!isOk || benchRate < 0) {
+                eInfo("Invalid --bench-rate {}", parser.value(benchRateOption));
+                std::exit(-1);
+            }
+        }
+    }
+
+    profiler.begin("node init");
     ExtraChainNodeWrapper* nodeWrapper = new ExtraChainNodeWrapper(&app);
     auto                   node        = nodeWrapper->node;
     nodeWrapper->Init(true);
+    profiler.begin("node initialised");
 
     if (parser.isSet(blockDisableCompress)) {
         // node->blockchain()->getBlockIndex().setBlockCompress(false);
@@ -330,6 +443,15 @@ int main(int argc, char* argv[]) {
 
     QObject::connect(node, &ExtraChainNode::NodeInitialised, [&]() {
         eLog("[Console] Activated");
+        // applied before anything else touches the dag or dfs
+        profiler.begin("dag/dfs modes");
+        node->dag()->set_mode(dagModeValue);
+        node->dfs()->set_mode(dfsModeValue);
+        eLog("[Console] Dag mode: {}, dfs mode: {}",
+             dagModeValue == DagMode::Light ? "light" : "full",
+             dfsModeValue == DfsMode::Light ? "light" : "full");
+
+        profiler.begin("console setup");
         console.setExtraChainNode(node);
         console.dfsStart();
 
@@ -345,6 +467,7 @@ int main(int argc, char* argv[]) {
         }
 
         if (isNewNetwork) {
+            profiler.begin("new network");
             bool res = node->create_new_network(email.toStdString(), password.toStdString());
             if (!res) {
                 eInfo("Can't create new network");
@@ -352,34 +475,19 @@ int main(int argc, char* argv[]) {
             }
         }
 
-        auto dagModeStr = parser.value(dagMode);
-        if (dagModeStr.toLower() == "light") {
-            nodeWrapper->node->dag()->set_mode(DagMode::Light);
-        } else {
-            nodeWrapper->node->dag()->set_mode(DagMode::Full);
-        }
-
-        auto dfsModeStr = parser.value(dfsMode);
-        if (dfsModeStr.toLower() == "light") {
-            nodeWrapper->node->dfs()->set_mode(DfsMode::Light);
-        } else {
-            nodeWrapper->node->dfs()->set_mode(DfsMode::Full);
-        }
-
         QString importFile = parser.value(importOption);
         if (!importFile.isEmpty()) {
-            QFile file(importFile);
-            file.open(QFile::ReadOnly);
-            auto data = file.readAll().toStdString();
-            if (data.empty()) {
+            profiler.begin("profile import");
+            auto data = ProfileFile::read(importFile);
+            if (!data.has_value() || data->empty()) {
                 eInfo("Incorrect import");
                 std::exit(0);
             }
-            node->import_profile(data, email.toStdString(), password.toStdString());
-            file.close();
+            node->import_profile(*data, email.toStdString(), password.toStdString());
         }
 
         if (node->accountController()->count() == 0) {
+            profiler.begin("login");
             std::string   loginHash;
             AutologinHash autologinHash;
             if (AutologinHash::isAvailable() && autologinHash.load()) {
@@ -400,12 +508,14 @@ int main(int argc, char* argv[]) {
         }
 
         if (parser.isSet(dag_genesis)) {
+            profiler.begin("dag genesis");
             node->create_new_dag();
         }
 
-        //
+        // each template is a phase of its own in --startup-report
         bool is_token = parser.isSet(tokenOption);
         if (is_token || isNewNetwork) {
+            profiler.begin("tokens cache");
             bool res1 = node->create_token_template();
             if (res1) {
                 eSuccess("Tokens cache template created");
@@ -414,15 +524,16 @@ int main(int argc, char* argv[]) {
                 if (res2) {
                     eSuccess("Tokens cache vector created");
                 } else {
-                    eInfo("Can't create tokens cache template");
+                    eInfo("Can't create tokens cache vector");
                 }
             } else {
-                eInfo("Can't create tokens cache vector");
+                eInfo("Can't create tokens cache template");
             }
         }
 
         bool is_username = parser.isSet(usernamesOption);
         if (is_username || isNewNetwork) {
+            profiler.begin("usernames vector");
             auto res = node->create_usernames_vector();
             if (!res) {
                 eInfo("Can't create usernames vector");
@@ -433,6 +544,7 @@ int main(int argc, char* argv[]) {
 
         bool is_renames = parser.isSet(renamesOption);
         if (is_renames || isNewNetwork) {
+            profiler.begin("renames template");
             auto res = node->create_renames_template();
             if (!res) {
                 eInfo("Can't create renames vector template");
@@ -443,6 +555,7 @@ int main(int argc, char* argv[]) {
 
         bool subscription_create = parser.isSet(subscriptionOption);
         if (subscription_create || isNewNetwork) {
+            profiler.begin("subscription template");
             auto res = node->create_subscription_template();
 
             // temp
@@ -457,6 +570,7 @@ int main(int argc, char* argv[]) {
 
         bool chat_create = parser.isSet(chatOption);
         if (chat_create || isNewNetwork) {
+            profiler.begin("chat templates");
             auto res = node->create_chat_templates();
 
             if (!res) {
@@ -487,70 +601,103 @@ int main(int argc, char* argv[]) {
             */
         }
 
-        bool is_local_clear_balance = parser.isSet(clearBalance);
-        if (is_local_clear_balance) {
-            eLog("Starting clear balances...");
-            auto actors = node->dag()->cache().local_clear_less_balances();
-            eLog("Done clear balances");
-            std::vector<ActorId> vec(actors.begin(), actors.end());
-            eLog("++++ {}", node->dag()->calculate_actors_balance(vec));
-        }
-
-        // eLog("++++ {}",
-        // node->dag()->calculate_actors_balance({ ActorId("1a902514053b9f2c814621799acbbef21e2ff6a5") }));
-
-        bool is_mega_import = parser.isSet(megaImportOption);
-        if (is_mega_import) {
-            if (node->dag()->current_section() != SectionId(0)) {
-                eFatal("Last section must be 0");
+        // jobs that touch the dag start once the balances are cleared, keeping the order clear, import, regen
+        auto startJobs = [&]() {
+            if (benchCount > 0) {
+                auto bench = new TxBenchmark(node, &app);
+                bench->setCount(benchCount);
+                bench->setRate(benchRate);
+                console.operationStarted();
+                QObject::connect(bench, &TxBenchmark::finished, [&console, bench, batch](QJsonObject result) {
+                    bench->deleteLater();
+                    console.operationFinished(result["rejected"].toInteger() == 0);
+                    // under --exec-file the batch decides when to exit
+                    if (batch == nullptr)
+                        qApp->exit(0);
+                });
+                bench->start();
             }
 
-            DbConnector db("0");
-            if (!db.open()) {
-                eFatal("Can't open console-data/0 mega block");
-            }
-
-            auto rows          = db.select("SELECT * FROM GenesisDataRow");
-            auto network_actor = node->accountController()->currentProfile().get_actor(node->network_id()).value();
-            auto section       = node->dag()->read_section(SectionId(0));
-
-            if (!section.has_value()) {
-                eFatal("No zero section");
+            auto regenerate_controls = [&]() {
+                if (parser.isSet(regenControls)) {
+                    node->dag()->clear_controls();
+                    node->dag()->generate_hash();
+                }
+            };
+
+            bool is_mega_import = parser.isSet(megaImportOption) || parser.isSet(megaResumeOption);
+            if (is_mega_import) {
+                auto importer = new MegaImporter(node, &app);
+                importer->setChunkSize(parser.value(megaChunkOption).toLongLong());
+                importer->setResume(parser.isSet(megaResumeOption));
+                console.operationStarted();
+                QObject::connect(importer,
+                                 &MegaImporter::finished,
+                                 [&console, importer, regenerate_controls](bool success) {
+                                     importer->deleteLater();
+                                     if (success)
+                                         regenerate_controls();
+                                     console.operationFinished(success);
+                                 });
+
+                if (!importer->start()) {
+                    importer->deleteLater();
+                    console.operationFinished(false);
+                }
                 return;
             }
 
-            for (auto& row : rows) {
-                Transaction tx;
-                tx.set_sender(node->network_id());
-                tx.set_receiver(ActorId(row["actorId"]));
-                tx.set_amount(BigNumberFloat(row["state"]));
-                tx.set_token(ActorId(row["token"]));
-                tx.set_type(TransactionType::Balance);
-                tx.set_section(SectionId(1));
-
-                if (section.has_value()) {
-                    tx.set_prev_hashs(section->hashs());
-                }
+            regenerate_controls();
+        };
 
-                tx.set_timestamp(Utils::current_date_ms());
-
-                auto sign_res = tx.sign(network_actor.get());
-                if (!sign_res) {
-                    eFatal("Sign balance error");
-                    return;
-                }
+        bool is_local_clear_balance = parser.isSet(clearBalance);
+        if (is_local_clear_balance) {
+            profiler.begin("clear balances");
+            auto cleaner = new BalanceCleaner(node, &app);
+            cleaner->setChunkSize(parser.value(clearBalanceChunk).toLongLong());
+            console.operationStarted();
+            QObject::connect(cleaner, &BalanceCleaner::finished, [&console, cleaner, startJobs](bool success) {
+                cleaner->deleteLater();
+                // the next jobs are pending before the cleaner stops counting, a batch can't finish in between
+                startJobs();
+                console.operationFinished(success);
+            });
+            cleaner->start();
+        }
 
-                Responder responder(node->network());
-                node->dag()->save_transaction(tx);
+        if (!seedsFile.isEmpty()) {
+            auto bootstrap = new PeerBootstrap(node, &app);
+            if (bootstrap->loadFile(seedsFile)) {
+                bootstrap->setKeep(parser.value(seedsKeepOption).toInt());
+                bootstrap->setTimeout(parser.value(seedsTimeoutOption).toInt());
+                bootstrap->setProtocol(*protocol);
+                // a batch run waits for the bootstrap like for any other pending operation
+                console.operationStarted();
+                QObject::connect(bootstrap, &PeerBootstrap::finished, [&console, bootstrap] {
+                    bootstrap->deleteLater();
+                    console.operationFinished(true);
+                });
+                bootstrap->start();
+            } else {
+                bootstrap->deleteLater();
             }
         }
 
-        if (parser.isSet(regenControls)) {
-            node->dag()->clear_controls();
-            node->dag()->generate_hash();
+        if (batch != nullptr)
+            QTimer::singleShot(0, batch, &BatchRunner::start);
+
+        profiler.end();
+        eLog("[Console] Startup finished in {} ms", profiler.elapsed());
+        if (parser.isSet(startupReportOption)) {
+            profiler.print();
+            profiler.save("startup-report.json");
         }
 
-        return;
+        // eLog("++++ {}",
+        // node->dag()->calculate_actors_balance({ ActorId("1a902514053b9f2c814621799acbbef21e2ff6a5") }));
+
+        if (!is_local_clear_balance)
+            startJobs();
     });
 
     return app.exec();
@@ -0,0 +1,76 @@
+/*
+ * ExtraChain Console Client
+ * Copyright (C) 2025 ExtraChain Foundation <official@extrachain.io>
+ *
+ * This library is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "console/balance_cleaner.h"
+
+#include <algorithm>
+
+#include "utils/exc_logs.h"
+
+BalanceCleaner::BalanceCleaner(ExtraChainNode *node, QObject *parent)
+    : QObject(parent)
+    , node(node) {
+    progressTimer.setInterval(2000);
+    connect(&progressTimer, &QTimer::timeout, this, &BalanceCleaner::printProgress);
+}
+
+void BalanceCleaner::setChunkSize(qint64 size) {
+    if (size > 0)
+        chunkSize = static_cast<size_t>(size);
+}
+
+void BalanceCleaner::start() {
+    eLog("Starting clear balances...");
+    timer.start();
+    auto cleared = node->dag()->cache().local_clear_less_balances();
+    actors.assign(cleared.begin(), cleared.end());
+    eLog("Done clear balances in {} ms, {} actors affected", timer.elapsed(), actors.size());
+
+    timer.restart();
+    progressTimer.start();
+    QTimer::singleShot(0, this, &BalanceCleaner::nextChunk);
+}
+
+void BalanceCleaner::nextChunk() {
+    if (done == actors.size()) {
+        progressTimer.stop();
+        eInfo("[Balance] Recalculated {} actors in {} ms", actors.size(), timer.elapsed());
+        emit finished(true);
+        return;
+    }
+
+    const size_t         end = std::min(actors.size(), done + chunkSize);
+    std::vector<ActorId> chunk(actors.begin() + done, actors.begin() + end);
+    const auto           balance = node->dag()->calculate_actors_balance(chunk);
+    done                         = end;
+    ++doneChunk;
+    eLog("[Balance] Chunk {}/{}: {}", doneChunk, (actors.size() + chunkSize - 1) / chunkSize, balance);
+
+    QTimer::singleShot(0, this, &BalanceCleaner::nextChunk);
+}
+
+void BalanceCleaner::printProgress() const {
+    const size_t total = actors.size();
+    if (total == 0)
+        return;
+
+    const qint64 elapsed = timer.elapsed();
+    const qint64 eta     = done == 0 ? 0 : elapsed * static_cast<qint64>(total - done) / static_cast<qint64>(done);
+    eInfo("[Balance] {}/{} actors ({}%), ETA {} s", done, total, done * 100 / total, eta / 1000);
+}
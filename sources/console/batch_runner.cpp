@@ -0,0 +1,152 @@
+/*
+ * ExtraChain Console Client
+ * Copyright (C) 2025 ExtraChain Foundation <official@extrachain.io>
+ *
+ * This library is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "console/batch_runner.h"
+
+#include <QCoreApplication>
+#include <QFile>
+#include <QTextStream>
+
+#include "console/console_manager.h"
+#include "utils/exc_logs.h"
+
+BatchRunner::BatchRunner(ConsoleManager *console, QObject *parent)
+    : QObject(parent)
+    , console(console) {
+    timeout.setSingleShot(true);
+    timeout.setInterval(std::chrono::minutes(10));
+    connect(&timeout, &QTimer::timeout, this, [this] {
+        eInfo("[Batch] Timeout, {} asynchronous commands still running", console->pendingOperations());
+        finish(false);
+    });
+    // jobs started with the node count as pending operations and may finish before the first command
+    connect(console, &ConsoleManager::operationsFinished, this, [this] {
+        if (current == commands.size())
+            finish(true);
+    });
+    connect(console, &ConsoleManager::operationFailed, this, [this] {
+        eInfo("[Batch] Asynchronous command failed");
+        finish(false);
+    });
+    elapsed.start();
+}
+
+bool BatchRunner::loadFile(const QString &path) {
+    QFile file(path);
+    if (!file.open(QFile::ReadOnly | QFile::Text)) {
+        eInfo("[Batch] Can't open {}: {}", path, file.errorString());
+        return false;
+    }
+
+    load(file);
+    if (commands.isEmpty()) {
+        eInfo("[Batch] No commands in {}", path);
+        return false;
+    }
+    eLog("[Batch] Loaded {} commands from {}", commands.size(), path);
+    return true;
+}
+
+bool BatchRunner::loadStdin() {
+    QFile file;
+    if (!file.open(stdin, QFile::ReadOnly | QFile::Text))
+        return false;
+
+    load(file);
+    if (commands.isEmpty()) {
+        eInfo("[Batch] No commands on stdin");
+        return false;
+    }
+    eLog("[Batch] Loaded {} commands from stdin", commands.size());
+    return true;
+}
+
+void BatchRunner::setTimeout(int seconds) {
+    if (seconds > 0)
+        timeout.setInterval(std::chrono::seconds(seconds));
+}
+
+void BatchRunner::load(QIODevice &device) {
+    QTextStream stream(&device);
+    QString     line;
+    while (stream.readLineInto(&line)) {
+        line = line.simplified();
+        if (!line.isEmpty() && !line.startsWith('#'))
+            commands.append(line);
+    }
+}
+
+void BatchRunner::start() {
+    if (done)
+        return;
+
+    elapsed.start();
+    runNext();
+}
+
+void BatchRunner::runNext() {
+    if (current == commands.size()) {
+        waitPending();
+        return;
+    }
+
+    const QString &command = commands[current++];
+    QElapsedTimer  timer;
+    timer.start();
+    auto status = console->execute(command);
+    eInfo("[Batch] #{} {} {} ms: {}", current, commandStatusName(status), timer.elapsed(), command);
+
+    if (status == CommandStatus::Pending)
+        ++pending;
+
+    if (status != CommandStatus::Ok && status != CommandStatus::Pending) {
+        finish(false);
+        return;
+    }
+
+    // let queued signals of the previous command through before the next one
+    QTimer::singleShot(0, this, &BatchRunner::runNext);
+}
+
+void BatchRunner::waitPending() {
+    if (console->pendingOperations() == 0) {
+        finish(true);
+        return;
+    }
+
+    eInfo("[Batch] Waiting for {} asynchronous commands", console->pendingOperations());
+    timeout.start();
+}
+
+void BatchRunner::finish(bool success) {
+    if (done)
+        return;
+
+    done = true;
+    timeout.stop();
+    disconnect(console, nullptr, this, nullptr);
+
+    eInfo("[Batch] {}: {}/{} commands, {} asynchronous, {} ms",
+          success ? "Done" : "Stopped",
+          current,
+          commands.size(),
+          pending,
+          elapsed.elapsed());
+    emit finished(success);
+}
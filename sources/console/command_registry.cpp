@@ -0,0 +1,109 @@
+/*
+ * ExtraChain Console Client
+ * Copyright (C) 2025 ExtraChain Foundation <official@extrachain.io>
+ *
+ * This library is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "console/command_registry.h"
+
+#include "utils/exc_logs.h"
+
+QString commandStatusName(CommandStatus status) {
+    switch (status) {
+    case CommandStatus::Ok:
+        return "ok";
+    case CommandStatus::Pending:
+        return "pending";
+    case CommandStatus::Failed:
+        return "failed";
+    case CommandStatus::InvalidArguments:
+        return "invalid arguments";
+    case CommandStatus::NotFound:
+        return "not found";
+    }
+    return "unknown";
+}
+
+void CommandRegistry::add(Command command) {
+    const size_t position = commands.size();
+    for (const auto &name : QStringList(command.aliases) << command.name) {
+        maxWords = std::max(maxWords, static_cast<int>(name.count(' ')) + 1);
+        index.insert(name, position);
+    }
+    commands.push_back(std::move(command));
+}
+
+const CommandRegistry::Command *CommandRegistry::find(const QStringList &tokens, int *words) const {
+    for (int count = std::min(maxWords, static_cast<int>(tokens.size())); count > 0; --count) {
+        auto it = index.constFind(count == 1 ? tokens.first() : tokens.mid(0, count).join(' '));
+        if (it != index.constEnd()) {
+            if (words != nullptr)
+                *words = count;
+            return &commands[*it];
+        }
+    }
+    return nullptr;
+}
+
+CommandStatus CommandRegistry::execute(const QString &line, bool nodeReady) const {
+    const QString     simplified = line.simplified();
+    const QStringList tokens     = simplified.split(' ', Qt::SkipEmptyParts);
+    if (tokens.isEmpty())
+        return CommandStatus::Ok;
+
+    int  words   = 0;
+    auto command = find(tokens, &words);
+    if (command == nullptr) {
+        eInfo("Unknown command \"{}\", type \"help\" for the list of commands", tokens.first());
+        return CommandStatus::NotFound;
+    }
+
+    CommandContext context { .args = tokens.mid(words), .rest = simplified.section(' ', words) };
+    const int      argc = static_cast<int>(context.args.size());
+    if (argc < command->minArgs || (command->maxArgs >= 0 && argc > command->maxArgs)) {
+        eInfo("Usage: {}", command->usage);
+        return CommandStatus::InvalidArguments;
+    }
+
+    if (command->needsNode && !nodeReady) {
+        eInfo("Command \"{}\" is not available until the node is initialised", command->name);
+        return CommandStatus::Failed;
+    }
+
+    return command->handler(context);
+}
+
+void CommandRegistry::printHelp(const QString &name) const {
+    if (!name.isEmpty()) {
+        auto command = find(name.split(' ', Qt::SkipEmptyParts));
+        if (command == nullptr) {
+            eInfo("Unknown command \"{}\"", name);
+            return;
+        }
+
+        eInfo("Usage: {}", command->usage);
+        eInfo("{}", command->help);
+        if (!command->aliases.isEmpty())
+            eInfo("Aliases: {}", command->aliases.join(", "));
+        return;
+    }
+
+    eInfo("Commands:");
+    for (const auto &command : commands)
+        eInfo("  {} {}", command.usage.leftJustified(32), command.help);
+    // the console runs inside the data directory, unlike --exec-file and --seeds on the command line
+    eInfo("Relative file paths in commands are resolved against the data directory");
+}
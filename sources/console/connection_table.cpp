@@ -0,0 +1,171 @@
+/*
+ * ExtraChain Console Client
+ * Copyright (C) 2025 ExtraChain Foundation <official@extrachain.io>
+ *
+ * This library is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "console/connection_table.h"
+
+#include <QHash>
+
+#include <algorithm>
+
+#include "managers/extrachain_node.h"
+#include "network/isocket_service.h"
+#include "network/network_manager.h"
+#include "utils/exc_logs.h"
+
+namespace {
+// connection fields are read as they are typed, these only pick the string conversion
+QString text(const std::string &value) {
+    return QString::fromStdString(value);
+}
+
+QString text(const QString &value) {
+    return value;
+}
+}
+
+std::optional<ConnectionTable::SortKey> ConnectionTable::parseSortKey(const QString &name) {
+    static const QHash<QString, SortKey> keys = { { "ip", SortKey::Ip },
+                                                  { "port", SortKey::Port },
+                                                  { "protocol", SortKey::Protocol },
+                                                  { "active", SortKey::Active },
+                                                  { "id", SortKey::Id } };
+
+    auto it = keys.find(name.toLower());
+    if (it == keys.end())
+        return std::nullopt;
+    return it.value();
+}
+
+ConnectionTable::ConnectionTable(ExtraChainNode *node) {
+    auto connections = node->network()->connections();
+    rows.reserve(connections->size());
+    std::for_each(connections->begin(), connections->end(), [this](auto &connection) {
+        rows.push_back({ .ip         = text(connection->ip()),
+                         .port       = static_cast<qint64>(connection->port()),
+                         .serverPort = static_cast<qint64>(connection->server_port()),
+                         .active     = static_cast<bool>(connection->is_active()),
+                         .protocol   = text(connection->protocol_string()),
+                         .identifier = text(connection->identifier()) });
+    });
+}
+
+size_t ConnectionTable::size() const {
+    return rows.size();
+}
+
+const std::vector<ConnectionTable::Row> &ConnectionTable::list() const {
+    return rows;
+}
+
+void ConnectionTable::sort(SortKey key) {
+    auto less = [key](const Row &a, const Row &b) {
+        switch (key) {
+        case SortKey::Ip:
+            return std::tie(a.ip, a.port) < std::tie(b.ip, b.port);
+        case SortKey::Port:
+            return a.port < b.port;
+        case SortKey::Protocol:
+            return a.protocol < b.protocol;
+        case SortKey::Active:
+            // active peers first
+            return a.active > b.active;
+        case SortKey::Id:
+            return a.identifier < b.identifier;
+        }
+        return false;
+    };
+    std::stable_sort(rows.begin(), rows.end(), less);
+}
+
+void ConnectionTable::printPage(int page) const {
+    const int pages = std::max(1, static_cast<int>((rows.size() + pageSize - 1) / pageSize));
+    page            = std::clamp(page, 1, pages);
+
+    eInfo("Connections: {}, page {}/{}", rows.size(), page, pages);
+    const size_t begin = static_cast<size_t>(page - 1) * pageSize;
+    printRows(begin, std::min(rows.size(), begin + pageSize));
+}
+
+void ConnectionTable::printAll() const {
+    eInfo("Connections: {}", rows.size());
+    printRows(0, rows.size());
+}
+
+void ConnectionTable::printRows(size_t begin, size_t end) const {
+    eInfo("{} {} {} {} {}",
+          QString("ip").leftJustified(40),
+          QString("port").rightJustified(6),
+          QString("server").rightJustified(6),
+          QString("proto").leftJustified(6),
+          "id");
+
+    for (size_t i = begin; i < end; ++i) {
+        const auto &row = rows[i];
+        eInfo("{} {} {} {} {}{}",
+              row.ip.leftJustified(40),
+              QString::number(row.port).rightJustified(6),
+              QString::number(row.serverPort).rightJustified(6),
+              row.protocol.leftJustified(6),
+              row.identifier,
+              row.active ? "" : " (inactive)");
+    }
+}
+
+bool ConnectionTable::printStats(const QString &id) const {
+    qint64                 total  = 0;
+    qint64                 active = 0;
+    QHash<QString, qint64> protocols;
+    QHash<QString, qint64> peers;
+    for (const auto &row : rows) {
+        // exact matches only, a prefix can name a different peer
+        if (!id.isEmpty() && row.identifier != id && row.ip != id)
+            continue;
+
+        ++total;
+        active += row.active ? 1 : 0;
+        ++protocols[row.protocol];
+        ++peers[row.ip];
+    }
+
+    if (total == 0) {
+        if (id.isEmpty())
+            eInfo("No connections");
+        else
+            eInfo("No connection {}", id);
+        return id.isEmpty();
+    }
+
+    std::vector<std::pair<QString, qint64>> busiest(peers.keyValueBegin(), peers.keyValueEnd());
+    std::sort(busiest.begin(), busiest.end(), [](const auto &a, const auto &b) {
+        return std::tie(b.second, a.first) < std::tie(a.second, b.first);
+    });
+    busiest.resize(std::min<size_t>(busiest.size(), 5));
+
+    eInfo("Connections {}", id.isEmpty() ? QString("(all)") : id);
+    eInfo("  total:       {}", total);
+    eInfo("  active:      {} ({}%)", active, active * 100 / total);
+    eInfo("  inactive:    {}", total - active);
+    eInfo("  addresses:   {}", peers.size());
+    for (auto it = protocols.constBegin(); it != protocols.constEnd(); ++it)
+        eInfo("  {} {}", (it.key() + ":").leftJustified(12), it.value());
+    eInfo("  most connections per address:");
+    for (const auto &[ip, count] : busiest)
+        eInfo("    {} {}", ip.leftJustified(40), count);
+    return true;
+}
@@ -23,22 +23,93 @@
 #include <QIODevice>
 #include <QtDebug>
 
+#include "managers/thread_pool.h"
+
+#ifdef Q_OS_UNIX
+    #include <cerrno>
+    #include <unistd.h> // STDIN_FILENO
+#endif
+#ifdef Q_OS_WIN
+    #include "Windows.h"
+#endif
+
 ConsoleInput::ConsoleInput(QObject *parent)
     : QObject(parent) {
 }
 
 ConsoleInput::~ConsoleInput() {
-    if (notifierInput != nullptr) {
-        delete notifierInput;
-    }
+    stop();
+}
+
+void ConsoleInput::start() {
+#ifdef Q_OS_UNIX
+    if (notifier != nullptr)
+        return;
+
+    notifier = new QSocketNotifier(STDIN_FILENO, QSocketNotifier::Read, this);
+    connect(notifier, &QSocketNotifier::activated, this, &ConsoleInput::readAvailable);
+#else
+    ThreadPool::addThread(this);
+#endif
+}
+
+void ConsoleInput::stop() {
+    if (stopped.exchange(true))
+        return;
+
+#ifdef Q_OS_UNIX
+    if (notifier != nullptr)
+        notifier->setEnabled(false);
+#endif
+#ifdef Q_OS_WIN
+    // wakes up the blocking console read in process()
+    CancelIoEx(GetStdHandle(STD_INPUT_HANDLE), nullptr);
+#endif
 }
 
 void ConsoleInput::process() {
-    notifierInput = new QTextStream(stdin, QIODevice::ReadOnly);
+    QTextStream stream(stdin, QIODevice::ReadOnly);
+    QString     line;
 
-    while (true) {
-        QString line = notifierInput->readLine();
+    while (!stopped && stream.readLineInto(&line)) {
+        line = line.trimmed();
         if (!line.isEmpty())
             emit this->input(line);
     }
+
+    stopped = true;
+    emit finished();
+}
+
+#ifdef Q_OS_UNIX
+void ConsoleInput::readAvailable() {
+    char          chunk[4096];
+    const ssize_t size = ::read(STDIN_FILENO, chunk, sizeof(chunk));
+    if (size < 0 && (errno == EINTR || errno == EAGAIN))
+        return;
+
+    if (size <= 0) {
+        notifier->setEnabled(false);
+        buffer.append('\n');
+        emitLines();
+        stopped = true;
+        emit finished();
+        return;
+    }
+
+    buffer.append(chunk, size);
+    emitLines();
+}
+
+void ConsoleInput::emitLines() {
+    qsizetype begin = 0;
+    qsizetype end   = 0;
+    while ((end = buffer.indexOf('\n', begin)) != -1) {
+        QString line = QString::fromUtf8(buffer.constData() + begin, end - begin).trimmed();
+        begin        = end + 1;
+        if (!line.isEmpty())
+            emit input(line);
+    }
+    buffer.remove(0, begin);
 }
+#endif
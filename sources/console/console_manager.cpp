@@ -22,6 +22,16 @@
 #include <QProcess>
 #include <QTextStream>
 
+#include "console/connection_table.h"
+#include "console/dfs_exporter.h"
+#include "console/dfs_uploader.h"
+#include "console/network_protocol.h"
+#include "console/peer_bootstrap.h"
+#include "console/profile_file.h"
+#include "console/transaction_batch.h"
+#include "console/transfer_monitor.h"
+#include "console/tx_benchmark.h"
+#include "console/wallet_creator.h"
 #include "managers/thread_pool.h"
 #include "dfs/dfs_controller.h"
 #include "chain/actor_index.h"
@@ -30,24 +40,31 @@
 #include "network/network_manager.h"
 #include "network/isocket_service.h"
 
-#ifdef Q_OS_UNIX
-    #include <unistd.h> // STDIN_FILENO
-#endif
 #ifdef Q_OS_WIN
     #include "Windows.h"
 #endif
 
 ConsoleManager::ConsoleManager(QObject *parent)
-    : QObject(parent)
-#ifdef Q_OS_UNIX
-// , notifier(STDIN_FILENO, QSocketNotifier::Read)
-// , notifierInput(stdin, QIODevice::ReadOnly)
-#endif
-{
+    : QObject(parent) {
     m_pushManager = new PushManager(node);
+    m_dfsExporter = new DfsExporter(this);
+    m_transfers   = new TransferMonitor(this);
+    connect(m_dfsExporter, &DfsExporter::progress, this, [this](QString file, qint64 done, qint64 total) {
+        m_transfers->update(TransferMonitor::Direction::Export, { .id = file.toStdString() }, done, total);
+    });
+    connect(m_dfsExporter, &DfsExporter::exported, this, [this](QString file, bool success, QString error) {
+        m_transfers->remove(TransferMonitor::Direction::Export, { .id = file.toStdString() });
+        if (success)
+            eInfo("Exported {}", file);
+        else
+            eInfo("Export of {} failed: {}", file, error);
+        operationFinished(success);
+    });
+    registerCommands();
 }
 
 ConsoleManager::~ConsoleManager() {
+    consoleInput.stop();
     eLog("[Console] Stop");
 }
 
@@ -78,243 +95,512 @@ void ConsoleManager::commandReceiver(QString command) {
     //        return;
     //    }
 
-    if (command == "quit" || command == "exit") {
-        eInfo("Exit...");
-        qApp->quit();
-    }
+    execute(command);
+}
 
-    if (command == "wipe") {
-        Utils::wipeDataFiles();
-        eInfo("Wiped and exit...");
-        qApp->quit();
-    }
+CommandStatus ConsoleManager::execute(const QString &command) {
+    return registry.execute(command, node != nullptr);
+}
 
-    if (command == "logs on") {
-        LogsManager::on();
-        eInfo("Logs enabled");
-    }
+const CommandRegistry &ConsoleManager::commands() const {
+    return registry;
+}
 
-    if (command == "logs off") {
-        LogsManager::off();
-        eInfo("Logs disabled");
-    }
+int ConsoleManager::pendingOperations() const {
+    return m_pendingOperations;
+}
 
-    if (command.left(3) == "dir") {
-        auto list = command.split(" ");
-        if (list.length() == 2) {
-            QString program = list[1].simplified();
+void ConsoleManager::operationStarted() {
+    ++m_pendingOperations;
+}
 
-            if (!program.isEmpty()) {
-                QProcess::execute(program, { QDir::currentPath() });
-                return;
-            }
-        }
+void ConsoleManager::operationFinished(bool ok) {
+    if (m_pendingOperations == 0)
+        return;
+
+    if (!ok)
+        emit operationFailed();
+    if (--m_pendingOperations == 0)
+        emit operationsFinished();
+}
+
+void ConsoleManager::registerCommands() {
+    registry.add({ .name      = "help",
+                   .usage     = "help [command]",
+                   .help      = "List commands or show usage of one command",
+                   .maxArgs   = -1,
+                   .needsNode = false,
+                   .handler   = [this](const CommandContext &context) {
+                       registry.printHelp(context.rest);
+                       return CommandStatus::Ok;
+                   } });
+
+    registry.add({ .name      = "quit",
+                   .usage     = "quit",
+                   .help      = "Stop the node and exit",
+                   .needsNode = false,
+                   .aliases   = { "exit" },
+                   .handler   = [](const CommandContext &) {
+                       eInfo("Exit...");
+                       qApp->quit();
+                       return CommandStatus::Ok;
+                   } });
+
+    registry.add({ .name      = "wipe",
+                   .usage     = "wipe",
+                   .help      = "Remove all data files and exit",
+                   .needsNode = false,
+                   .handler   = [](const CommandContext &) {
+                       Utils::wipeDataFiles();
+                       eInfo("Wiped and exit...");
+                       qApp->quit();
+                       return CommandStatus::Ok;
+                   } });
+
+    registry.add({ .name      = "logs on",
+                   .usage     = "logs on",
+                   .help      = "Enable logs",
+                   .needsNode = false,
+                   .handler   = [](const CommandContext &) {
+                       LogsManager::on();
+                       eInfo("Logs enabled");
+                       return CommandStatus::Ok;
+                   } });
+
+    registry.add({ .name      = "logs off",
+                   .usage     = "logs off",
+                   .help      = "Disable logs",
+                   .needsNode = false,
+                   .handler   = [](const CommandContext &) {
+                       LogsManager::off();
+                       eInfo("Logs disabled");
+                       return CommandStatus::Ok;
+                   } });
+
+    registry.add({ .name      = "dir",
+                   .usage     = "dir [program]",
+                   .help      = "Open the data directory",
+                   .maxArgs   = 1,
+                   .needsNode = false,
+                   .handler   = [](const CommandContext &context) {
+                       if (!context.args.isEmpty()) {
+                           QProcess::execute(context.args[0], { QDir::currentPath() });
+                           return CommandStatus::Ok;
+                       }
 
 #if defined(Q_OS_LINUX)
-        QProcess::execute("xdg-open", { QDir::currentPath() });
+                       QProcess::execute("xdg-open", { QDir::currentPath() });
 #elif defined(Q_OS_WIN)
-        QProcess::execute("explorer.exe", { QDir::currentPath().replace("/", "\\") });
+                       QProcess::execute("explorer.exe", { QDir::currentPath().replace("/", "\\") });
 #elif defined(Q_OS_MAC)
-        QProcess::execute("open", { QDir::currentPath() });
+                       QProcess::execute("open", { QDir::currentPath() });
 #else
-        eInfo("Command \"dir\" not implemented for this platform");
+                       eInfo("Command \"dir\" not implemented for this platform");
+                       return CommandStatus::Failed;
 #endif
-    }
-
-    if (command.left(6) == "transaction") {
-        eLog("[Console] 'transaction' command");
-        auto    mainActorId = node->accountController()->system_actor().id();
-        ActorId firstId     = node->actorIndex()->network_id();
-
-        QStringList sendtx = command.split(" ");
-        if (sendtx.length() == 3) {
-            QByteArray     toId   = sendtx[1].toUtf8();
-            BigNumberFloat amount = BigNumberFloat(sendtx[2].toStdString());
-            eLog("transaction {} {}", toId, amount.to_string(NumeralBase::Dec));
-
-            ActorId receiver(toId.toStdString());
-
-            // BigNumberFloat amount(toAmount.toStdString());
-            if (toId == "burn") {
-                receiver = ActorId();
-            }
-
-            Transaction tx;
-            tx.set_sender(mainActorId);
-            tx.set_receiver(receiver);
-            tx.set_amount(amount);
-            // createTransaction
-            node->send_transaction(tx, node->accountController()->system_actor());
-
-            //            if (mainActorId != firstId)
-            //            node->createTransaction(receiver, BigNumberFloat(10), ActorId());
-            //            else
-            //                node->createTransactionFrom(firstId, receiver, BigNumberFloat(10), ActorId());
-        }
-    }
-
-    if (command == "cn count" || command == "connections count") {
-        eInfo("Connections: {}", node->network()->connections()->size());
-    }
-
-    if (command == "cn list" || command == "connections list") {
-        auto connections = *node->network()->connections();
-
-        if (connections->size() > 0) {
-            eInfo("Connections:");
-            std::for_each(connections->begin(), connections->end(), [](auto &el) {
-                qInfo().noquote() << el->ip() << el->port() << el->server_port() << el->is_active()
-                                  << el->protocol_string() << el->identifier();
-            });
-        } else {
-            eInfo("No connections");
-        }
-        eInfo("-----------");
-    }
-
-    if (command.left(7) == "connect") {
-        auto list = command.split(" ");
-        if (list.length() != 3)
-            return;
-
-        QString ip = list[2];
-        if (ip == "local")
-            ip = Utils::findLocalIp().ip().toString();
-        QString protocol = list[1];
-
-        if (Utils::isValidIp(ip) && (protocol == "udp" || protocol == "ws")) {
-            auto networkProtocol = Network::Protocol::WebSocket;
-            qInfo().noquote() << "Connect to" << ip << protocol;
-            node->network()->connectToNode(ip, networkProtocol);
-        } else {
-            eInfo("Invalid connect input");
-        }
-    }
-
-    if (command.left(7) == "wallet ") {
-        auto list = command.split(" ");
-        if (list.length() > 1) {
-            if (list[1] == "new") {
-                auto actor = node->accountController()->createWallet();
-                eInfo("Wallet created: {}", actor.id());
-            }
-
-            if (list[1] == "list") {
-                eInfo("Wallets:");
-                auto actors = node->accountController()->accounts();
-                auto mainId = node->accountController()->system_actor().id();
-                eInfo("User {}", mainId);
-                for (const auto &actor : actors) {
-                    if (actor.id() != node->accountController()->system_actor().id()) {
-                        eInfo("Wallet {}", actor.id());
-                    }
-                }
-            }
-
-            if (list[1] == "balance" || list[1] == "check_balance") {
-                // const auto actors = node->actorIndex()->allActors();
-                // for (int i = 0; i < actors.size(); i++) {
-                //     const auto balance =
-                //         node->blockchain()->calculate_actor_balance(ActorId(actors[i]), ActorId());
-                //     eInfo("[Actor: {}, balance: ", actors[i], balance);
-                // }
-            }
-        }
-    }
-
-    if (command.left(4) == "push") {
-        command.replace(QRegularExpression("\\s+"), " ");
-        QString actorId = command.mid(5, 40);
-        // Notification notify { .time = 100, .type = Notification::NewPost, .data = actorId.toLatin1() + " " };
-        // m_pushManager->pushNotification(actorId, notify);
-    }
-
-    if (command.left(8) == "dfs add ") {
-        auto                  file = command.mid(8).toStdWString();
-        std::filesystem::path filepath(file);
-        eInfo("Adding file to DFS: {}", command.mid(8));
-
-        auto actor_id = node->accountController()->system_actor().id();
-        auto result   = node->dfs()->store_file(actor_id,
-                                              actor_id,
-                                              file,
-                                              "",
-                                              filepath.filename().string(),
-                                              Dfs::DataSecurity::Public);
-        if (!result.has_value())
-            return;
-
-        if (!result.has_value()) {
-            eInfo("Error: {}", result.error());
-        }
-    }
-
-    if (command.left(8) == "dfs get ") {
-        auto list = command.split(" ");
-        if (list.size() < 4) {
-            eInfo("List has less 2 parameters");
-        } else {
-            const std::string pathToNewFolder = list[2].toStdString();
-            const std::string pathToDfsFile   = list[3].toStdString();
-            if (pathToNewFolder.empty() || pathToDfsFile.empty()) {
-                eLog("One or more parameters is empty. Please check in parameters.");
-                return;
-            }
-
-            // if (list.size() == 5) {
-            //     node->dfs()->exportFile(pathToNewFolder, pathToDfsFile, list[4].toStdString());
-            // } else if (list.size() == 4) {
-            //     node->dfs()->exportFile(pathToNewFolder, pathToDfsFile);
-            // }
-        }
-    }
-
-    if (command.left(6) == "export") {
-        auto exported = node->export_profile();
-        if (!exported.has_value()) {
-            eInfo("Can't export, error: {}", exported.error());
-        }
-        auto    data = QString::fromStdString(exported.value());
-        QString fileName =
-            QString("%1.extrachain").arg(node->accountController()->system_actor().id().toQString());
-        QFile file(fileName);
-        file.open(QFile::WriteOnly);
-        if (file.write(data.toUtf8()) > 1)
-            eInfo("Exported to {}", fileName);
-        file.close();
-    }
-
-    if (command.left(16) == "list_user_files ") {
-        auto userId = command.split(" ")[1];
-        eInfo("show list user  {}  files", userId);
-        std::filesystem::path actorFolderPath = DfsB::DFS_FOLDER + "/" + userId.toStdString();
-        std::cout << "======================================================" << std::endl;
-
-        for (const auto &entry : std::filesystem::recursive_directory_iterator(actorFolderPath)) {
-            const auto fileName = entry.path().filename();
-            if (fileName == "." || fileName == ".." || fileName == ".dir" || fileName == ".DS_Store")
-                continue;
-
-            if (!std::filesystem::is_directory(entry)) {
-                const std::string filePath = actorFolderPath.string() + "/" + entry.path().filename().string();
-                std::cout << entry.path() << std::endl;
-            } else {
-                std::cout << "------------------------------------------------------" << std::endl;
-            }
-        }
-        std::cout << "======================================================" << std::endl;
-    }
+                       return CommandStatus::Ok;
+                   } });
+
+    registry.add({ .name    = "transaction",
+                   .usage   = "transaction <to|burn> <amount>",
+                   .help    = "Send coins from the main actor",
+                   .minArgs = 2,
+                   .maxArgs = 2,
+                   .handler = [this](const CommandContext &context) {
+                       eLog("[Console] 'transaction' command");
+                       auto mainActorId = node->accountController()->system_actor().id();
+
+                       QByteArray     toId   = context.args[0].toUtf8();
+                       BigNumberFloat amount = BigNumberFloat(context.args[1].toStdString());
+                       eLog("transaction {} {}", toId, amount.to_string(NumeralBase::Dec));
+
+                       ActorId receiver(toId.toStdString());
+                       if (toId == "burn") {
+                           receiver = ActorId();
+                       }
+
+                       auto tx = TransactionBatch::makeTransaction(mainActorId, receiver, amount);
+                       node->send_transaction(tx, node->accountController()->system_actor());
+                       m_balances.invalidate(mainActorId.toQString());
+                       m_balances.invalidate(receiver.toQString());
+                       return CommandStatus::Ok;
+                   } });
+
+    registry.add({ .name    = "transaction batch",
+                   .usage   = "transaction batch <csv> [chunk]",
+                   .help    = "Send transactions from receiver,amount[,token] csv relative to the data directory",
+                   .minArgs = 1,
+                   .maxArgs = 2,
+                   .handler = [this](const CommandContext &context) {
+                       auto batch = new TransactionBatch(node, this);
+                       if (context.args.size() == 2)
+                           batch->setChunkSize(context.args[1].toInt());
+                       if (!batch->load(context.args[0])) {
+                           batch->deleteLater();
+                           return CommandStatus::Failed;
+                       }
+
+                       operationStarted();
+                       connect(batch, &TransactionBatch::finished, this, [this, batch](qint64, qint64 rejected) {
+                           batch->deleteLater();
+                           m_balances.clear();
+                           operationFinished(rejected == 0);
+                       });
+                       batch->start();
+                       return CommandStatus::Pending;
+                   } });
+
+    registry.add({ .name    = "bench tx",
+                   .usage   = "bench tx <count> [rate] [receiver]",
+                   .help    = "Submit test transactions and report TPS and latency, rate 0 is unlimited",
+                   .minArgs = 1,
+                   .maxArgs = 3,
+                   .handler = [this](const CommandContext &context) {
+                       bool   isOk  = false;
+                       qint64 count = context.args[0].toLongLong(&isOk);
+                       if (!isOk || count <= 0) {
+                           eInfo("Invalid transactions count");
+                           return CommandStatus::InvalidArguments;
+                       }
+
+                       auto bench = new TxBenchmark(node, this);
+                       bench->setCount(count);
+                       if (context.args.size() > 1)
+                           bench->setRate(context.args[1].toLongLong());
+                       if (context.args.size() > 2)
+                           bench->setReceiver(ActorId(context.args[2].toStdString()));
+
+                       operationStarted();
+                       connect(bench, &TxBenchmark::finished, this, [this, bench](QJsonObject result) {
+                           bench->deleteLater();
+                           m_balances.clear();
+                           operationFinished(result["rejected"].toInteger() == 0);
+                       });
+                       bench->start();
+                       return CommandStatus::Pending;
+                   } });
+
+    registry.add({ .name    = "cn count",
+                   .usage   = "cn count",
+                   .help    = "Print the number of connections",
+                   .aliases = { "connections count" },
+                   .handler = [this](const CommandContext &) {
+                       eInfo("Connections: {}", node->network()->connections()->size());
+                       return CommandStatus::Ok;
+                   } });
+
+    registry.add({ .name    = "cn list",
+                   .usage   = "cn list",
+                   .help    = "Print all connections",
+                   .aliases = { "connections list" },
+                   .handler = [this](const CommandContext &) {
+                       ConnectionTable table(node);
+                       if (table.size() == 0) {
+                           eInfo("No connections");
+                           return CommandStatus::Ok;
+                       }
+
+                       table.printAll();
+                       return CommandStatus::Ok;
+                   } });
+
+    registry.add({ .name    = "cn top",
+                   .usage   = "cn top <ip|port|protocol|active|id> [page]",
+                   .help    = "Print one page of connections sorted by a field",
+                   .minArgs = 1,
+                   .maxArgs = 2,
+                   .aliases = { "connections top", "cn list --sort", "connections list --sort" },
+                   .handler = [this](const CommandContext &context) {
+                       const auto key  = ConnectionTable::parseSortKey(context.args[0]);
+                       int        page = 1;
+                       if (context.args.size() > 1)
+                           page = context.args[1].toInt();
+                       if (!key.has_value() || page < 1)
+                           return CommandStatus::InvalidArguments;
+
+                       ConnectionTable table(node);
+                       table.sort(*key);
+                       table.printPage(page);
+                       return CommandStatus::Ok;
+                   } });
+
+    registry.add({ .name    = "cn stats",
+                   .usage   = "cn stats [id|ip]",
+                   .help    = "Print connection counts by state, protocol and address, for all peers or one",
+                   .maxArgs = 1,
+                   .aliases = { "connections stats" },
+                   .handler = [this](const CommandContext &context) {
+                       const QString id = context.args.isEmpty() ? QString() : context.args[0];
+                       return ConnectionTable(node).printStats(id) ? CommandStatus::Ok : CommandStatus::Failed;
+                   } });
+
+    registry.add({ .name    = "connect",
+                   .usage   = "connect <udp|ws> <ip|local>",
+                   .help    = "Connect to a node",
+                   .minArgs = 2,
+                   .maxArgs = 2,
+                   .handler = [this](const CommandContext &context) {
+                       QString ip = context.args[1];
+                       if (ip == "local")
+                           ip = Utils::findLocalIp().ip().toString();
+                       auto protocol = parseProtocol(context.args[0]);
+
+                       if (!Utils::isValidIp(ip) || !protocol.has_value()) {
+                           eInfo("Invalid connect input");
+                           return CommandStatus::InvalidArguments;
+                       }
+
+                       qInfo().noquote() << "Connect to" << ip << protocolName(*protocol);
+                       node->network()->connectToNode(ip, *protocol);
+                       return CommandStatus::Ok;
+                   } });
+
+    registry.add({ .name    = "connect file",
+                   .usage   = "connect file <seeds> [keep] [window]",
+                   .help    = "Dial peers from a seed list over the --protocol transport, report the fastest",
+                   .minArgs = 1,
+                   .maxArgs = 3,
+                   .handler = [this](const CommandContext &context) {
+                       auto bootstrap = new PeerBootstrap(node, this);
+                       if (!bootstrap->loadFile(context.args[0])) {
+                           bootstrap->deleteLater();
+                           return CommandStatus::Failed;
+                       }
+                       if (context.args.size() > 1)
+                           bootstrap->setKeep(context.args[1].toInt());
+                       if (context.args.size() > 2)
+                           bootstrap->setWindow(context.args[2].toInt());
+                       bootstrap->setProtocol(m_protocol);
+
+                       operationStarted();
+                       connect(bootstrap, &PeerBootstrap::finished, this, [this, bootstrap] {
+                           bootstrap->deleteLater();
+                           operationFinished(true);
+                       });
+                       bootstrap->start();
+                       return CommandStatus::Pending;
+                   } });
+
+    registry.add({ .name    = "wallet new",
+                   .usage   = "wallet new [count] [ids file]",
+                   .help    = "Create wallets, optionally writing ids to a file relative to the data directory",
+                   .maxArgs = 2,
+                   .handler = [this](const CommandContext &context) {
+                       bool   isOk  = true;
+                       qint64 count = context.args.isEmpty() ? 1 : context.args[0].toLongLong(&isOk);
+                       if (!isOk || count < 1)
+                           return CommandStatus::InvalidArguments;
+
+                       auto creator = new WalletCreator(node, this);
+                       creator->setCount(count);
+                       if (context.args.size() == 2)
+                           creator->setOutput(context.args[1]);
+
+                       operationStarted();
+                       connect(creator, &WalletCreator::finished, this, [this, creator](qint64, bool success) {
+                           creator->deleteLater();
+                           operationFinished(success);
+                       });
+                       creator->start();
+                       return CommandStatus::Pending;
+                   } });
+
+    registry.add({ .name    = "wallet list",
+                   .usage   = "wallet list",
+                   .help    = "List wallets of the profile",
+                   .handler = [this](const CommandContext &) {
+                       eInfo("Wallets:");
+                       auto actors = node->accountController()->accounts();
+                       auto mainId = node->accountController()->system_actor().id();
+                       eInfo("User {}", mainId);
+                       for (const auto &actor : actors) {
+                           if (actor.id() != mainId) {
+                               eInfo("Wallet {}", actor.id());
+                           }
+                       }
+                       return CommandStatus::Ok;
+                   } });
+
+    registry.add({ .name    = "wallet balance",
+                   .usage   = "wallet balance [--json] [actor id...]",
+                   .help    = "Print balances of the given actors or of all profile wallets",
+                   .maxArgs = -1,
+                   .aliases = { "wallet check_balance" },
+                   .handler = [this](const CommandContext &context) {
+                       QStringList args = context.args;
+                       const bool  json = args.removeAll("--json") > 0;
+
+                       std::vector<std::pair<QString, ActorId>> actors;
+                       if (args.isEmpty()) {
+                           auto mainId = node->accountController()->system_actor().id();
+                           for (const auto &actor : node->accountController()->accounts())
+                               actors.emplace_back(actor.id() == mainId ? "User" : "Wallet", actor.id());
+                       }
+                       for (const auto &id : args) {
+                           if (!TransactionBatch::isActorId(id.toStdString())) {
+                               eInfo("Invalid actor id {}", id);
+                               return CommandStatus::InvalidArguments;
+                           }
+                           actors.emplace_back("Actor", ActorId(id.toStdString()));
+                       }
+
+                       const auto entries = m_balances.query(node, actors);
+                       if (json)
+                           eInfo("{}", WalletBalances::toJson(entries));
+                       else
+                           WalletBalances::printTable(entries);
+                       return CommandStatus::Ok;
+                   } });
+
+    registry.add({ .name    = "push",
+                   .usage   = "push <actorId>",
+                   .help    = "Send a test push notification",
+                   .minArgs = 1,
+                   .maxArgs = 1,
+                   .handler = [](const CommandContext &context) {
+                       QString actorId = context.args[0].left(40);
+                       Q_UNUSED(actorId)
+                       // Notification notify { .time = 100, .type = Notification::NewPost, .data =
+                       // actorId.toLatin1() + " " }; m_pushManager->pushNotification(actorId, notify);
+                       return CommandStatus::Ok;
+                   } });
+
+    registry.add({ .name    = "dfs add",
+                   .usage   = "dfs add <path>",
+                   .help    = "Add a file to DFS",
+                   .minArgs = 1,
+                   .maxArgs = -1,
+                   .handler = [this](const CommandContext &context) {
+                       eInfo("Adding file to DFS: {}", context.rest);
+                       auto uploader = new DfsUploader(node, this);
+                       if (!uploader->addFile(context.rest.toStdWString())) {
+                           uploader->deleteLater();
+                           return CommandStatus::Failed;
+                       }
+
+                       operationStarted();
+                       connect(uploader, &DfsUploader::finished, this, [this, uploader](qint64, qint64 failed) {
+                           uploader->deleteLater();
+                           operationFinished(failed == 0);
+                       });
+                       uploader->start();
+                       return CommandStatus::Pending;
+                   } });
+
+    registry.add({ .name    = "dfs add -r",
+                   .usage   = "dfs add -r <dir> [concurrency]",
+                   .help    = "Add all files of a directory to DFS",
+                   .minArgs = 1,
+                   .maxArgs = 2,
+                   .handler = [this](const CommandContext &context) {
+                       auto uploader = new DfsUploader(node, this);
+                       if (!uploader->scan(context.args[0].toStdWString())) {
+                           uploader->deleteLater();
+                           return CommandStatus::Failed;
+                       }
+                       if (context.args.size() == 2)
+                           uploader->setConcurrency(context.args[1].toInt());
+
+                       operationStarted();
+                       connect(uploader, &DfsUploader::finished, this, [this, uploader](qint64, qint64 failed) {
+                           uploader->deleteLater();
+                           operationFinished(failed == 0);
+                       });
+                       uploader->start();
+                       return CommandStatus::Pending;
+                   } });
+
+    registry.add({ .name    = "dfs get",
+                   .usage   = "dfs get <folder> <dfs file> [name]",
+                   .help    = "Copy a DFS file to a folder as stored (raw), resumes an interrupted export",
+                   .minArgs = 2,
+                   .maxArgs = 3,
+                   .handler = [this](const CommandContext &context) {
+                       const auto folder  = std::filesystem::path(context.args[0].toStdWString());
+                       const auto dfsFile = std::filesystem::path(context.args[1].toStdWString());
+                       const auto name    = context.args.size() == 3 ? context.args[2] : QString();
+
+                       operationStarted();
+                       if (!m_dfsExporter->exportFile(dfsFile, folder, name)) {
+                           operationFinished(false);
+                           return CommandStatus::Failed;
+                       }
+                       return CommandStatus::Pending;
+                   } });
+
+    registry.add({ .name    = "export",
+                   .usage   = "export [-z] [file]",
+                   .help    = "Export the profile to file or <actor id>.extrachain, -z compresses it",
+                   .maxArgs = 2,
+                   .handler = [this](const CommandContext &context) {
+                       QStringList args     = context.args;
+                       const bool  compress = args.removeAll("-z") > 0;
+                       if (args.size() > 1)
+                           return CommandStatus::InvalidArguments;
+
+                       auto exported = node->export_profile();
+                       if (!exported.has_value()) {
+                           eInfo("Can't export, error: {}", exported.error());
+                           return CommandStatus::Failed;
+                       }
+
+                       const auto    actorId  = node->accountController()->system_actor().id().toQString();
+                       const QString fileName = args.isEmpty() ? QString("%1.extrachain").arg(actorId) : args[0];
+                       if (!ProfileFile::write(fileName, exported.value(), compress))
+                           return CommandStatus::Failed;
+                       eInfo("Exported to {}", fileName);
+                       return CommandStatus::Ok;
+                   } });
+
+    registry.add({ .name    = "list_user_files",
+                   .usage   = "list_user_files <actorId>",
+                   .help    = "List local DFS files of an actor",
+                   .minArgs = 1,
+                   .maxArgs = 1,
+                   .handler = [](const CommandContext &context) {
+                       const auto &userId = context.args[0];
+                       eInfo("show list user  {}  files", userId);
+                       std::filesystem::path actorFolderPath = DfsB::DFS_FOLDER + "/" + userId.toStdString();
+                       std::cout << "======================================================" << std::endl;
+
+                       for (const auto &entry : std::filesystem::recursive_directory_iterator(actorFolderPath)) {
+                           const auto fileName = entry.path().filename();
+                           if (fileName == "." || fileName == ".." || fileName == ".dir"
+                               || fileName == ".DS_Store")
+                               continue;
+
+                           if (!std::filesystem::is_directory(entry)) {
+                               std::cout << entry.path() << std::endl;
+                           } else {
+                               std::cout << "------------------------------------------------------" << std::endl;
+                           }
+                       }
+                       std::cout << "======================================================" << std::endl;
+                       return CommandStatus::Ok;
+                   } });
 }
 
 PushManager *ConsoleManager::pushManager() const {
     return m_pushManager;
 }
 
+void ConsoleManager::setProtocol(Network::Protocol protocol) {
+    m_protocol = protocol;
+}
+
 void ConsoleManager::setExtraChainNode(ExtraChainNode *value) {
     node = value;
+    m_pushManager->setAccController(node);
+    m_balances.clear();
 
     // auto dfs = node->dfs();
     connect(node, &ExtraChainNode::pushNotification, m_pushManager, &PushManager::pushNotification);
+    // transaction notifications are raised when the node saves a transaction of the actor
+    connect(node, &ExtraChainNode::pushNotification, this, [this](QString actorId, Notification notification) {
+        if (notification.type == Notification::NotifyType::TxToUser
+            || notification.type == Notification::NotifyType::TxToMe)
+            m_balances.invalidate(actorId);
+    });
     // connect(dfs, &Dfs::chatMessage, m_pushManager, &PushManager::chatMessage);
     // connect(dfs, &Dfs::fileAdded, m_pushManager, &PushManager::fileAdded);
     // connect(resolver, &ResolveManager::saveNotificationToken, this,
@@ -335,15 +621,13 @@ void ConsoleManager::startInput() {
     //     return;
     // }
 
-    connect(&consoleInput, &ConsoleInput::input, this, &ConsoleManager::commandReceiver);
-    ThreadPool::addThread(&consoleInput);
-#elif defined(Q_OS_UNIX)
-    // connect(&notifier, &QSocketNotifier::activated, [this] {
-    //     QString line = notifierInput.readLine();
-    //     if (!line.isEmpty())
-    //         commandReceiver(line);
-    // });
 #endif
+
+    connect(&consoleInput, &ConsoleInput::input, this, &ConsoleManager::commandReceiver);
+    connect(&consoleInput, &ConsoleInput::finished, this, [] {
+        eLog("[Console] Input closed");
+    });
+    consoleInput.start();
 }
 
 void ConsoleManager::saveNotificationToken(QByteArray os, ActorId actorId, ActorId token) {
@@ -364,13 +648,21 @@ void ConsoleManager::dfsStart() {
 
     connect(node->dfs(),
             &DfsController::downloadProgress,
-            [](ActorId owner_id, std::string file_id, int progress) {
-                // eInfo("[Console/DFS] Download progress: {}/{}: {}", owner_id, file_id, progress);
+            this,
+            [this](ActorId owner_id, std::string file_id, int progress) {
+                m_transfers->update(TransferMonitor::Direction::Download,
+                                    { owner_id.to_string(), std::move(file_id) },
+                                    progress);
             });
 
-    connect(node->dfs(), &DfsController::uploadProgress, [](ActorId owner_id, std::string file_id, int progress) {
-        // eInfo("[Console/DFS] Upload progress: {}/{}: {}", owner_id, file_id, progress);
-    });
+    connect(node->dfs(),
+            &DfsController::uploadProgress,
+            this,
+            [this](ActorId owner_id, std::string file_id, int progress) {
+                m_transfers->update(TransferMonitor::Direction::Upload,
+                                    { owner_id.to_string(), std::move(file_id) },
+                                    progress);
+            });
 }
 
 QString ConsoleManager::getSomething(const QString &name) {
@@ -0,0 +1,172 @@
+/*
+ * ExtraChain Console Client
+ * Copyright (C) 2025 ExtraChain Foundation <official@extrachain.io>
+ *
+ * This library is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "console/dfs_exporter.h"
+
+#include <QDateTime>
+#include <QFile>
+#include <QFileInfo>
+#include <QJsonDocument>
+#include <QJsonObject>
+
+#include <algorithm>
+
+#include "dfs/dfs_controller.h"
+#include "utils/exc_logs.h"
+
+namespace {
+// identifies the source a .part file was copied from, a changed source restarts the export
+QByteArray sourceStamp(const QString &source) {
+    const QFileInfo info(source);
+    QJsonObject     json;
+    json["source"]   = info.absoluteFilePath();
+    json["size"]     = info.size();
+    json["modified"] = info.lastModified().toMSecsSinceEpoch();
+    return QJsonDocument(json).toJson(QJsonDocument::Compact);
+}
+
+QString toQString(const std::filesystem::path &path) {
+    return QString::fromStdWString(path.wstring());
+}
+}
+
+DfsExporter::DfsExporter(QObject *parent)
+    : QObject(parent) {
+    pool.setMaxThreadCount(4);
+}
+
+void DfsExporter::setConcurrency(int value) {
+    if (value > 0)
+        pool.setMaxThreadCount(value);
+}
+
+bool DfsExporter::exportFile(const std::filesystem::path &dfsFile,
+                             const std::filesystem::path &folder,
+                             const QString               &name) {
+    // the dfs path comes from the console, it must not leave the DFS folder
+    const bool escapes = dfsFile.empty() || dfsFile.has_root_path()
+        || std::any_of(dfsFile.begin(), dfsFile.end(), [](const auto &part) {
+               return part == "..";
+           });
+    if (escapes || name.contains('/') || name.contains('\\') || name == "." || name == "..") {
+        eInfo("[Dfs] Invalid export path {}", dfsFile.string());
+        return false;
+    }
+
+    const auto      source = std::filesystem::path(DfsB::DFS_FOLDER) / dfsFile;
+    std::error_code error;
+    if (!std::filesystem::is_regular_file(source, error)) {
+        eInfo("[Dfs] File {} is not stored locally", dfsFile.string());
+        return false;
+    }
+
+    std::filesystem::create_directories(folder, error);
+    if (error) {
+        eInfo("[Dfs] Can't create {}: {}", folder.string(), error.message());
+        return false;
+    }
+
+    const auto fileName = name.isEmpty() ? source.filename() : std::filesystem::path(name.toStdWString());
+    const auto target   = std::filesystem::absolute(folder / fileName, error).lexically_normal();
+    // a second export to the same target would share its .part file
+    if (targets.contains(toQString(target))) {
+        eInfo("[Dfs] {} is already being exported", target.string());
+        return false;
+    }
+
+    targets.insert(toQString(target));
+    ++running;
+    pool.start([this, source, target] {
+        copy(source, target);
+    });
+    return true;
+}
+
+int DfsExporter::active() const {
+    return running;
+}
+
+void DfsExporter::copy(std::filesystem::path source, std::filesystem::path target) {
+    const QString fileName = toQString(target);
+    auto          done     = [this, fileName](bool success, QString error) {
+        QMetaObject::invokeMethod(this, [this, fileName, success, error] {
+            --running;
+            targets.remove(fileName);
+            emit exported(fileName, success, error);
+        });
+    };
+
+    QFile input(toQString(source));
+    QFile part(fileName + ".part");
+    QFile stamp(fileName + ".part.source");
+    if (!input.open(QFile::ReadOnly)) {
+        done(false, input.errorString());
+        return;
+    }
+
+    // resume from the last whole chunk of a previous attempt, if it copied this very source
+    const QByteArray expected = sourceStamp(input.fileName());
+    const bool       same     = stamp.open(QFile::ReadOnly) && stamp.readAll() == expected;
+    stamp.close();
+
+    const qint64 total  = input.size();
+    qint64       offset = same && part.exists() ? part.size() / chunkSize * chunkSize : 0;
+    if (offset > total)
+        offset = 0;
+    if (offset == 0
+        && (!stamp.open(QFile::WriteOnly | QFile::Truncate) || stamp.write(expected) != expected.size())) {
+        done(false, stamp.errorString());
+        return;
+    }
+    stamp.close();
+    if (!part.open(offset > 0 ? QFile::ReadWrite : QFile::WriteOnly | QFile::Truncate) || !part.resize(offset)
+        || !part.seek(offset) || !input.seek(offset)) {
+        done(false, part.errorString());
+        return;
+    }
+
+    QByteArray buffer(chunkSize, Qt::Uninitialized);
+    int        reported = -1;
+    while (offset < total) {
+        const qint64 size = input.read(buffer.data(), chunkSize);
+        if (size <= 0 || part.write(buffer.constData(), size) != size) {
+            done(false, size <= 0 ? input.errorString() : part.errorString());
+            return;
+        }
+        offset += size;
+
+        const int percent = static_cast<int>(offset * 100 / total);
+        if (percent != reported) {
+            reported = percent;
+            QMetaObject::invokeMethod(this, [this, fileName, offset, total] {
+                emit progress(fileName, offset, total);
+            });
+        }
+    }
+
+    part.close();
+    QFile::remove(fileName);
+    if (!part.rename(fileName)) {
+        done(false, part.errorString());
+        return;
+    }
+    stamp.remove();
+
+    done(true, {});
+}
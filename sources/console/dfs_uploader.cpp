@@ -0,0 +1,251 @@
+/*
+ * ExtraChain Console Client
+ * Copyright (C) 2025 ExtraChain Foundation <official@extrachain.io>
+ *
+ * This library is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "console/dfs_uploader.h"
+
+#include <QFile>
+
+#include "console/parallel.h"
+#include "dfs/dfs_controller.h"
+#include "managers/account_controller.h"
+#include "utils/exc_logs.h"
+
+#ifdef Q_OS_LINUX
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+namespace {
+void prefetchFile(const std::filesystem::path &path) {
+#ifdef Q_OS_LINUX
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        return;
+    posix_fadvise(fd, 0, 0, POSIX_FADV_WILLNEED);
+    ::close(fd);
+#else
+    QFile file(QString::fromStdWString(path.wstring()));
+    if (!file.open(QFile::ReadOnly))
+        return;
+    char buffer[1 << 16];
+    while (file.read(buffer, sizeof(buffer)) > 0) {
+    }
+#endif
+}
+
+double megabytesPerSecond(qint64 bytes, qint64 ms) {
+    return static_cast<double>(bytes) / (1024 * 1024) * 1000 / std::max<qint64>(ms, 1);
+}
+}
+
+DfsUploader::DfsUploader(ExtraChainNode *node, QObject *parent)
+    : QObject(parent)
+    , node(node) {
+    idleTimer.setInterval(1000);
+    connect(&idleTimer, &QTimer::timeout, this, &DfsUploader::checkIdle);
+}
+
+bool DfsUploader::addFile(const std::filesystem::path &file) {
+    std::error_code error;
+    const auto      size = std::filesystem::file_size(file, error);
+    if (error) {
+        eInfo("[Dfs] Can't read {}: {}", file.string(), error.message());
+        return false;
+    }
+
+    queue.push_back({ .path = file, .size = static_cast<qint64>(size) });
+    totalBytes += static_cast<qint64>(size);
+    ++totalFiles;
+    return true;
+}
+
+bool DfsUploader::scan(const std::filesystem::path &dir) {
+    std::error_code error;
+    if (!std::filesystem::is_directory(dir, error)) {
+        eInfo("[Dfs] Not a directory: {}", dir.string());
+        return false;
+    }
+
+    auto options = std::filesystem::directory_options::skip_permission_denied;
+    for (auto it = std::filesystem::recursive_directory_iterator(dir, options, error);
+         it != std::filesystem::recursive_directory_iterator();
+         it.increment(error)) {
+        if (error)
+            break;
+        if (!it->is_regular_file(error))
+            continue;
+
+        std::error_code sizeError;
+        const auto      size = it->file_size(sizeError);
+        if (sizeError) {
+            eInfo("[Dfs] Skipping {}: {}", it->path().string(), sizeError.message());
+            continue;
+        }
+        queue.push_back({ .path = it->path(), .size = static_cast<qint64>(size) });
+        totalBytes += static_cast<qint64>(size);
+    }
+
+    if (error) {
+        eInfo("[Dfs] Can't read {}: {}", dir.string(), error.message());
+        return false;
+    }
+
+    totalFiles = static_cast<qint64>(queue.size());
+    return true;
+}
+
+void DfsUploader::setConcurrency(int value) {
+    if (value > 0)
+        concurrency = value;
+}
+
+void DfsUploader::setIdleTimeout(int seconds) {
+    if (seconds > 0)
+        idleTimeoutMs = seconds * 1000LL;
+}
+
+void DfsUploader::start() {
+    owner = node->accountController()->system_actor().id();
+    connect(node->dfs(), &DfsController::uploaded, this, [this](ActorId owner_id, Dfs::DirRow dirRow) {
+        if (owner_id == owner)
+            fileUploaded(dfsFileId(dirRow));
+    });
+    connect(node->dfs(),
+            &DfsController::uploadProgress,
+            this,
+            [this](ActorId owner_id, std::string file_id, int) {
+                auto it = uploads.find(QString::fromStdString(file_id));
+                if (owner_id == owner && it != uploads.end())
+                    it->lastActivity = timer.elapsed();
+            });
+
+    eInfo("[Dfs] Adding {} files, {:.1f} MB, concurrency {}",
+          totalFiles,
+          static_cast<double>(totalBytes) / (1024 * 1024),
+          concurrency);
+    timer.start();
+    idleTimer.start();
+    startNext();
+}
+
+void DfsUploader::startNext() {
+    while (uploads.size() < concurrency && !queue.empty()) {
+        File file = std::move(queue.front());
+        queue.pop_front();
+        readAheadDone = readAheadDone > 0 ? readAheadDone - 1 : 0;
+
+        storing     = true;
+        auto result = node->dfs()->store_file(owner,
+                                              owner,
+                                              file.path.wstring(),
+                                              "",
+                                              file.path.filename().string(),
+                                              Dfs::DataSecurity::Public);
+        storing = false;
+        if (!result.has_value()) {
+            ++failedFiles;
+            eInfo("[Dfs] Error for {}: {}", file.path.string(), result.error());
+            continue;
+        }
+
+        const auto fileId = dfsFileId(result.value());
+        if (uploadedEarly.erase(fileId) > 0)
+            countUploaded(file);
+        else
+            uploads.insert(QString::fromStdString(fileId), { std::move(file), timer.elapsed() });
+    }
+
+    readAhead();
+    if (uploads.isEmpty() && queue.empty())
+        finish();
+}
+
+void DfsUploader::readAhead() {
+    if (prefetch.valid() && prefetch.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+        return;
+
+    const size_t window = std::min(queue.size(), static_cast<size_t>(concurrency));
+    if (readAheadDone >= window)
+        return;
+
+    std::vector<std::filesystem::path> paths;
+    for (; readAheadDone < window; ++readAheadDone)
+        paths.push_back(queue[readAheadDone].path);
+    prefetch = runInPool([paths = std::move(paths)] {
+        parallelFor(
+            paths.size(),
+            [&](size_t i) {
+                prefetchFile(paths[i]);
+            },
+            1);
+    });
+}
+
+void DfsUploader::fileUploaded(const std::string &fileId) {
+    auto it = uploads.find(QString::fromStdString(fileId));
+    if (it == uploads.end()) {
+        // DFS may finish a small file inside store_file, before its id is known here
+        if (storing)
+            uploadedEarly.insert(fileId);
+        return;
+    }
+
+    countUploaded(it->file);
+    uploads.erase(it);
+    startNext();
+}
+
+void DfsUploader::countUploaded(const File &file) {
+    uploadedBytes += file.size;
+    ++uploadedFiles;
+    eInfo("[Dfs] {}/{} files, {:.1f} MB/s",
+          uploadedFiles + failedFiles,
+          totalFiles,
+          megabytesPerSecond(uploadedBytes, timer.elapsed()));
+}
+
+void DfsUploader::checkIdle() {
+    const qint64 now     = timer.elapsed();
+    qint64       expired = 0;
+    for (auto it = uploads.begin(); it != uploads.end();) {
+        if (now - it->lastActivity < idleTimeoutMs) {
+            ++it;
+            continue;
+        }
+        eInfo("[Dfs] No progress for {} s, giving up on {}", idleTimeoutMs / 1000, it->file.path.string());
+        it = uploads.erase(it);
+        ++expired;
+    }
+
+    failedFiles += expired;
+    if (expired > 0)
+        startNext();
+}
+
+void DfsUploader::finish() {
+    idleTimer.stop();
+    disconnect(node->dfs(), nullptr, this, nullptr);
+    eInfo("[Dfs] Added {} files, {} failed, {:.1f} MB in {} ms, {:.1f} MB/s",
+          uploadedFiles,
+          failedFiles,
+          static_cast<double>(uploadedBytes) / (1024 * 1024),
+          timer.elapsed(),
+          megabytesPerSecond(uploadedBytes, timer.elapsed()));
+    emit finished(uploadedFiles, failedFiles);
+}
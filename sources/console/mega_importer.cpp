@@ -0,0 +1,263 @@
+/*
+ * ExtraChain Console Client
+ * Copyright (C) 2025 ExtraChain Foundation <official@extrachain.io>
+ *
+ * This library is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "console/mega_importer.h"
+
+#include <QFile>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QSaveFile>
+#include <QTimer>
+
+#include <algorithm>
+#include <cstring>
+
+#include "console/parallel.h"
+#include "managers/account_controller.h"
+#include "utils/exc_logs.h"
+#include "utils/exc_utils.h"
+
+MegaImporter::MegaImporter(ExtraChainNode *node, QObject *parent)
+    : QObject(parent)
+    , node(node)
+    , db("0") {
+}
+
+void MegaImporter::setChunkSize(qint64 size) {
+    if (size > 0)
+        chunkSize = size;
+}
+
+void MegaImporter::setResume(bool value) {
+    resume = value;
+}
+
+bool MegaImporter::start() {
+    if (!loadCheckpoint())
+        return false;
+
+    // saved rows may already have moved the dag past section 0
+    if (lastReadRowid == 0 && node->dag()->current_section() != SectionId(0)) {
+        eFatal("Last section must be 0");
+        return false;
+    }
+
+    if (!db.open()) {
+        eFatal("Can't open console-data/0 mega block");
+        return false;
+    }
+
+    auto section = node->dag()->read_section(SectionId(0));
+    if (!section.has_value()) {
+        eFatal("No zero section");
+        return false;
+    }
+
+    auto network_actor = node->accountController()->currentProfile().get_actor(node->network_id()).value();
+    sign               = [network_actor](Transaction &tx) {
+        return static_cast<bool>(tx.sign(network_actor.get()));
+    };
+
+    txTemplate.set_sender(node->network_id());
+    txTemplate.set_type(TransactionType::Balance);
+    txTemplate.set_section(SectionId(1));
+    txTemplate.set_prev_hashs(section->hashs());
+
+    auto count = db.select("SELECT COUNT(*) AS count FROM GenesisDataRow");
+    total      = count.empty() ? 0 : QString::fromStdString(count[0]["count"]).toLongLong();
+
+    journal.setFileName(journalFile);
+    if (!journal.open(QFile::WriteOnly | QFile::Append)) {
+        eFatal("Can't open {}: {}", journalFile, journal.errorString());
+        return false;
+    }
+
+    if (lastReadRowid != 0)
+        eInfo("[Mega] Resuming after row {}, {} rows already imported", lastReadRowid, imported);
+    eInfo("[Mega] Import of {} rows started, chunk {}, workers {}", total, chunkSize, workerCount());
+    timer.start();
+    prefetch();
+    QTimer::singleShot(0, this, &MegaImporter::step);
+    return true;
+}
+
+std::vector<MegaImporter::GenesisRow> MegaImporter::readChunk() {
+    auto rows = db.select(fmt::format("SELECT rowid AS rowid, actorId, state, token FROM GenesisDataRow "
+                                      "WHERE rowid > {} ORDER BY rowid LIMIT {}",
+                                      lastReadRowid,
+                                      chunkSize));
+
+    std::vector<GenesisRow> chunk;
+    chunk.reserve(rows.size());
+    for (auto &row : rows) {
+        chunk.push_back({ .rowid   = QString::fromStdString(row["rowid"]).toLongLong(),
+                          .actorId = std::move(row["actorId"]),
+                          .state   = std::move(row["state"]),
+                          .token   = std::move(row["token"]) });
+    }
+
+    if (!chunk.empty())
+        lastReadRowid = chunk.back().rowid;
+    return chunk;
+}
+
+MegaImporter::SignedChunk MegaImporter::signChunk(const std::vector<GenesisRow> &rows) const {
+    SignedChunk chunk;
+    chunk.transactions.resize(rows.size(), txTemplate);
+    chunk.rowids.reserve(rows.size());
+    for (const auto &row : rows)
+        chunk.rowids.push_back(row.rowid);
+
+    std::vector<char> signedRows(rows.size(), 0);
+    parallelFor(rows.size(), [&](size_t i) {
+        auto       &tx  = chunk.transactions[i];
+        const auto &row = rows[i];
+        tx.set_receiver(ActorId(row.actorId));
+        tx.set_amount(BigNumberFloat(row.state));
+        tx.set_token(ActorId(row.token));
+        tx.set_timestamp(Utils::current_date_ms());
+        signedRows[i] = sign(tx);
+    });
+
+    auto failed = std::find(signedRows.begin(), signedRows.end(), 0);
+    if (failed != signedRows.end())
+        chunk.failedRowid = rows[failed - signedRows.begin()].rowid;
+    chunk.lastRowid = rows.empty() ? lastReadRowid : rows.back().rowid;
+    return chunk;
+}
+
+void MegaImporter::prefetch() {
+    pending = runInPool([this, rows = readChunk()] {
+        return signChunk(rows);
+    });
+}
+
+void MegaImporter::step() {
+    auto chunk = pending.get();
+    if (chunk.failedRowid != 0) {
+        eFatal("Sign balance error, row {}", chunk.failedRowid);
+        finish(false);
+        return;
+    }
+
+    if (chunk.transactions.empty()) {
+        saveCheckpoint(chunk.lastRowid, true);
+        finish(true);
+        return;
+    }
+
+    // next chunk is signed while this one is written
+    prefetch();
+
+    for (size_t i = 0; i < chunk.transactions.size(); ++i) {
+        node->dag()->save_transaction(chunk.transactions[i]);
+        // journaled right after the save, a crash loses at most the row being saved
+        journal.write(reinterpret_cast<const char *>(&chunk.rowids[i]), sizeof(qint64));
+        journal.flush();
+    }
+    imported += static_cast<qint64>(chunk.transactions.size());
+    saveCheckpoint(chunk.lastRowid, false);
+
+    const qint64 elapsed = std::max<qint64>(timer.elapsed(), 1);
+    eInfo("[Mega] {}/{} rows, {} rows/s", imported, total, imported * 1000 / elapsed);
+
+    QTimer::singleShot(0, this, &MegaImporter::step);
+}
+
+void MegaImporter::finish(bool success) {
+    const qint64 elapsed = std::max<qint64>(timer.elapsed(), 1);
+    if (success)
+        eSuccess("[Mega] Imported {} rows in {} s, {} rows/s",
+                 imported,
+                 elapsed / 1000,
+                 imported * 1000 / elapsed);
+    else
+        eInfo("[Mega] Import stopped after {} rows", imported);
+
+    emit finished(success);
+}
+
+bool MegaImporter::loadCheckpoint() {
+    if (!resume) {
+        if (node->dag()->current_section() != SectionId(0)) {
+            eFatal("Previous mega import already saved rows, use --import-resume");
+            return false;
+        }
+        // a fresh import starts from the first row, leftovers of an earlier run must not be replayed later
+        if ((QFile::exists(checkpointFile) && !QFile::remove(checkpointFile))
+            || (QFile::exists(journalFile) && !QFile::remove(journalFile))) {
+            eFatal("Can't remove {} or {}", checkpointFile, journalFile);
+            return false;
+        }
+        return true;
+    }
+
+    QFile file(checkpointFile);
+    if (!file.exists()) {
+        eInfo("[Mega] No checkpoint found, replaying the journal");
+    } else {
+        if (!file.open(QFile::ReadOnly)) {
+            eFatal("Can't read {}", checkpointFile);
+            return false;
+        }
+
+        auto json = QJsonDocument::fromJson(file.readAll()).object();
+        if (json["done"].toBool()) {
+            eInfo("[Mega] Import already completed, {} rows", json["imported"].toInteger());
+            return false;
+        }
+        lastReadRowid = json["rowid"].toInteger();
+        imported      = json["imported"].toInteger();
+    }
+
+    // rows saved after the last checkpoint. A crash between a checkpoint and the journal
+    // truncation leaves rows the checkpoint already covers, those are skipped.
+    QFile saved(journalFile);
+    if (saved.open(QFile::ReadOnly)) {
+        const QByteArray data    = saved.readAll();
+        const qint64     rows    = data.size() / static_cast<qint64>(sizeof(qint64));
+        const qint64     covered = lastReadRowid;
+        for (qint64 i = 0; i < rows; ++i) {
+            qint64 rowid = 0;
+            std::memcpy(&rowid, data.constData() + i * sizeof(qint64), sizeof(qint64));
+            if (rowid <= covered)
+                continue;
+            lastReadRowid = std::max(lastReadRowid, rowid);
+            ++imported;
+        }
+    }
+    return true;
+}
+
+void MegaImporter::saveCheckpoint(qint64 rowid, bool done) {
+    QJsonObject json;
+    json["rowid"]    = rowid;
+    json["imported"] = imported;
+    json["done"]     = done;
+
+    QSaveFile file(checkpointFile);
+    if (!file.open(QFile::WriteOnly) || file.write(QJsonDocument(json).toJson(QJsonDocument::Compact)) < 0
+        || !file.commit()) {
+        eInfo("[Mega] Can't write checkpoint: {}", file.errorString());
+        return;
+    }
+
+    // the checkpoint now covers every journaled row
+    journal.resize(0);
+}
@@ -0,0 +1,100 @@
+/*
+ * ExtraChain Console Client
+ * Copyright (C) 2025 ExtraChain Foundation <official@extrachain.io>
+ *
+ * This library is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "console/notification_coalescer.h"
+
+#include <algorithm>
+
+void NotificationCoalescer::Bucket::refill(double rate, double burst, qint64 now) {
+    if (updatedAt == 0)
+        tokens = burst;
+    else
+        tokens = std::min(burst, tokens + rate * static_cast<double>(now - updatedAt) / 1000);
+    updatedAt = now;
+}
+
+NotificationCoalescer::NotificationCoalescer(QObject *parent)
+    : QObject(parent) {
+    clock.start();
+    timer.setInterval(tickInterval);
+    connect(&timer, &QTimer::timeout, this, &NotificationCoalescer::tick);
+}
+
+void NotificationCoalescer::add(QString actorId, Notification notification) {
+    auto &queue = queues[actorId];
+    if (queue.byType.isEmpty()) {
+        queue.firstAt = std::max<qint64>(clock.elapsed(), 1);
+        order.push_back(actorId);
+    }
+
+    auto &pending  = queue.byType[static_cast<int>(notification.type)];
+    pending.latest = std::move(notification);
+    ++pending.count;
+
+    if (!timer.isActive())
+        timer.start();
+}
+
+void NotificationCoalescer::tick() {
+    const qint64 now = std::max<qint64>(clock.elapsed(), 1);
+    globalBucket.refill(globalRate, globalBurst, now);
+
+    // Actors take turns: each turn sends at most one type and moves the actor to the
+    // back, so a short global bucket is shared and the next tick resumes where this
+    // one stopped. The round ends once nobody in the queue could send.
+    size_t idle = 0;
+    while (!order.empty() && idle < order.size() && globalBucket.tokens >= 1) {
+        const QString actorId = order.front();
+        order.pop_front();
+
+        auto &queue = queues[actorId];
+        bool  sent  = false;
+        if (now - queue.firstAt >= window) {
+            auto &actorBucket = actorBuckets[actorId];
+            actorBucket.refill(actorRate, actorBurst, now);
+            if (actorBucket.tokens >= 1) {
+                auto type = queue.byType.begin();
+                actorBucket.tokens -= 1;
+                globalBucket.tokens -= 1;
+                emit ready(actorId, type->latest, type->count);
+                queue.byType.erase(type);
+                sent = true;
+            }
+        }
+
+        if (queue.byType.isEmpty())
+            queues.remove(actorId);
+        else
+            order.push_back(actorId);
+        idle = sent ? 0 : idle + 1;
+    }
+
+    if (actorBuckets.size() > maxIdleBuckets) {
+        // a bucket refilled to its burst carries no state
+        for (auto it = actorBuckets.begin(); it != actorBuckets.end();) {
+            if (!queues.contains(it.key()) && now - it->updatedAt > actorBurst / actorRate * 1000)
+                it = actorBuckets.erase(it);
+            else
+                ++it;
+        }
+    }
+
+    if (queues.isEmpty())
+        timer.stop();
+}
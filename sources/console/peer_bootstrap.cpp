@@ -0,0 +1,178 @@
+/*
+ * ExtraChain Console Client
+ * Copyright (C) 2025 ExtraChain Foundation <official@extrachain.io>
+ *
+ * This library is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "console/peer_bootstrap.h"
+
+#include <QFile>
+
+#include <algorithm>
+
+#include "console/connection_table.h"
+#include "console/network_protocol.h"
+#include "network/network_manager.h"
+#include "utils/exc_logs.h"
+#include "utils/exc_utils.h"
+
+PeerBootstrap::PeerBootstrap(ExtraChainNode *node, QObject *parent)
+    : QObject(parent)
+    , node(node) {
+    pollTimer.setInterval(50);
+    connect(&pollTimer, &QTimer::timeout, this, &PeerBootstrap::poll);
+}
+
+bool PeerBootstrap::loadFile(const QString &path) {
+    QFile file(path);
+    if (!file.open(QFile::ReadOnly | QFile::Text)) {
+        eInfo("[Seeds] Can't read {}: {}", path, file.errorString());
+        return false;
+    }
+
+    QSet<QString> unique;
+    while (!file.atEnd()) {
+        QString ip = QString::fromUtf8(file.readLine()).section('#', 0, 0).trimmed();
+        if (ip.isEmpty())
+            continue;
+        if (ip == "local")
+            ip = Utils::findLocalIp().ip().toString();
+        if (!Utils::isValidIp(ip)) {
+            eInfo("[Seeds] Skipping invalid address {}", ip);
+            continue;
+        }
+        if (!unique.contains(ip)) {
+            unique.insert(ip);
+            seeds.push_back(ip);
+        }
+    }
+
+    if (seeds.empty()) {
+        eInfo("[Seeds] No addresses in {}", path);
+        return false;
+    }
+    return true;
+}
+
+void PeerBootstrap::setWindow(int value) {
+    if (value > 0)
+        window = value;
+}
+
+void PeerBootstrap::setTimeout(int ms) {
+    if (ms > 0)
+        timeoutMs = ms;
+}
+
+void PeerBootstrap::setKeep(int value) {
+    if (value > 0)
+        keep = value;
+}
+
+void PeerBootstrap::setProtocol(Network::Protocol value) {
+    protocol = value;
+}
+
+void PeerBootstrap::start() {
+    // a peer that is already connected can't be timed, and would look like an instant handshake
+    const auto connected = activePeers();
+    const auto before    = seeds.size();
+    std::erase_if(seeds, [&](const QString &ip) {
+        return connected.contains(ip);
+    });
+    if (seeds.size() < before)
+        eInfo("[Seeds] {} peers already connected, not dialled", before - seeds.size());
+
+    eInfo("[Seeds] Dialling {} peers over {}, window {}, timeout {} ms, keep {}",
+          seeds.size(),
+          protocolName(protocol),
+          window,
+          timeoutMs,
+          keep);
+    timer.start();
+    dialNext();
+    pollTimer.start();
+}
+
+QSet<QString> PeerBootstrap::activePeers() const {
+    QSet<QString> active;
+    ConnectionTable table(node);
+    for (const auto &row : table.list()) {
+        // IPv4 peers accepted on a dual-stack socket are reported as mapped addresses
+        if (row.active)
+            active.insert(row.ip.startsWith("::ffff:") ? row.ip.mid(7) : row.ip);
+    }
+    return active;
+}
+
+void PeerBootstrap::dialNext() {
+    while (!seeds.empty() && static_cast<int>(dials.size()) < window && static_cast<int>(peers.size()) < keep) {
+        const QString ip = seeds.front();
+        seeds.pop_front();
+        dials.push_back({ ip, timer.elapsed() });
+        node->network()->connectToNode(ip, protocol);
+    }
+}
+
+void PeerBootstrap::poll() {
+    const auto   active = activePeers();
+    const qint64 now    = timer.elapsed();
+    std::erase_if(dials, [&](const Dial &dial) {
+        if (active.contains(dial.ip)) {
+            // the first keep answers are ranked, slower ones stay connected but are only counted
+            if (static_cast<int>(peers.size()) < keep)
+                peers.push_back({ dial.ip, now - dial.startedMs });
+            else
+                ++late;
+            return true;
+        }
+        if (now - dial.startedMs >= timeoutMs) {
+            eLog("[Seeds] {} timed out", dial.ip);
+            ++failed;
+            return true;
+        }
+        return false;
+    });
+
+    // the network manager can't cancel a dial, these may still connect after the bootstrap
+    if (static_cast<int>(peers.size()) >= keep) {
+        unanswered += static_cast<int>(dials.size());
+        dials.clear();
+    }
+
+    dialNext();
+    if (dials.empty())
+        finish();
+}
+
+void PeerBootstrap::finish() {
+    pollTimer.stop();
+    std::sort(peers.begin(), peers.end(), [](const Peer &a, const Peer &b) {
+        return a.latencyMs < b.latencyMs;
+    });
+
+    eInfo("[Seeds] {} fastest peers, {} answered later, {} timed out, {} not waited for, {} not dialled, {} ms",
+          peers.size(),
+          late,
+          failed,
+          unanswered,
+          seeds.size(),
+          timer.elapsed());
+    for (const auto &peer : peers)
+        eInfo("[Seeds]   {} {} ms", peer.ip.leftJustified(40), peer.latencyMs);
+
+    emit finished(static_cast<int>(peers.size()));
+}
@@ -0,0 +1,103 @@
+/*
+ * ExtraChain Console Client
+ * Copyright (C) 2025 ExtraChain Foundation <official@extrachain.io>
+ *
+ * This library is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "console/profile_file.h"
+
+#include <QFile>
+#include <QSaveFile>
+
+#include <algorithm>
+
+#include "utils/exc_logs.h"
+
+namespace {
+constexpr char   magic[]   = { 'E', 'X', 'C', 'Z' };
+constexpr qint64 magicSize = sizeof(magic);
+constexpr qint64 chunkSize = 1024 * 1024;
+
+bool writeAll(QSaveFile &file, const char *data, qint64 size) {
+    for (qint64 offset = 0; offset < size; offset += chunkSize) {
+        const qint64 length = std::min(chunkSize, size - offset);
+        if (file.write(data + offset, length) != length)
+            return false;
+    }
+    return true;
+}
+}
+
+namespace ProfileFile {
+
+bool write(const QString &path, const std::string &data, bool compress) {
+    QSaveFile file(path);
+    if (!file.open(QFile::WriteOnly)) {
+        eInfo("Can't write {}: {}", path, file.errorString());
+        return false;
+    }
+
+    bool written = false;
+    if (compress) {
+        const QByteArray packed =
+            qCompress(reinterpret_cast<const uchar *>(data.data()), static_cast<qsizetype>(data.size()));
+        written = writeAll(file, magic, magicSize) && writeAll(file, packed.constData(), packed.size());
+    } else {
+        written = writeAll(file, data.data(), static_cast<qint64>(data.size()));
+    }
+
+    if (!written || !file.commit()) {
+        eInfo("Can't write {}: {}", path, file.errorString());
+        file.cancelWriting();
+        return false;
+    }
+    return true;
+}
+
+std::optional<std::string> read(const QString &path) {
+    QFile file(path);
+    if (!file.open(QFile::ReadOnly)) {
+        eInfo("Can't read {}: {}", path, file.errorString());
+        return std::nullopt;
+    }
+
+    qint64 size = file.size();
+    if (size == 0)
+        return std::nullopt;
+
+    const uchar *mapped = file.map(0, size);
+    QByteArray   buffer;
+    if (mapped == nullptr) {
+        // mapping is not supported everywhere, e.g. on some virtual file systems
+        buffer = file.readAll();
+        mapped = reinterpret_cast<const uchar *>(buffer.constData());
+        size   = buffer.size();
+    }
+
+    const char *data = reinterpret_cast<const char *>(mapped);
+    if (size > magicSize && std::equal(magic, magic + magicSize, data)) {
+        const QByteArray unpacked = qUncompress(mapped + magicSize, static_cast<qsizetype>(size - magicSize));
+        if (unpacked.isEmpty()) {
+            eInfo("Corrupted compressed profile {}", path);
+            return std::nullopt;
+        }
+        return std::string(unpacked.constData(), static_cast<size_t>(unpacked.size()));
+    }
+
+    return std::string(data, static_cast<size_t>(size));
+}
+
+}
@@ -0,0 +1,93 @@
+/*
+ * ExtraChain Console Client
+ * Copyright (C) 2025 ExtraChain Foundation <official@extrachain.io>
+ *
+ * This library is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "console/push_broadcast.h"
+
+#include <QCoreApplication>
+#include <QPointer>
+
+#include <memory>
+
+#include "console/parallel.h"
+#include "utils/exc_logs.h"
+
+PushBroadcast::PushBroadcast(PushTokenStore *store, Decoder decoder, Sender sender, QObject *parent)
+    : QObject(parent)
+    , store(store)
+    , decoder(std::move(decoder))
+    , sender(std::move(sender)) {
+}
+
+void PushBroadcast::start(int pageSize) {
+    this->pageSize = std::max(pageSize, 1);
+    timer.start();
+    readPage();
+}
+
+void PushBroadcast::readPage() {
+    auto tokens = store->page(rowid, pageSize);
+    if (tokens.empty()) {
+        stats.ms = timer.elapsed();
+        eLog("[Push] Broadcast: {} tokens in {} pages, {} queued, {} skipped, {} ms",
+             stats.tokens,
+             stats.pages,
+             stats.queued,
+             stats.skipped,
+             stats.ms);
+        emit finished(stats);
+        return;
+    }
+
+    ++stats.pages;
+    stats.tokens += static_cast<qint64>(tokens.size());
+
+    // the page is decoded off the event loop, the broadcast may be gone when it comes back
+    struct Page {
+        std::vector<PushToken> tokens;
+        std::vector<char>      valid;
+    };
+    auto page    = std::make_shared<Page>();
+    page->tokens = std::move(tokens);
+    page->valid.assign(page->tokens.size(), 0);
+
+    QPointer<PushBroadcast> guard(this);
+    runInPool([page, guard, decoder = decoder] {
+        parallelFor(page->tokens.size(), [&](size_t i) {
+            page->valid[i] = decoder(page->tokens[i]);
+        });
+
+        QMetaObject::invokeMethod(qApp, [page, guard] {
+            if (guard)
+                guard->decoded(std::move(page->tokens), std::move(page->valid));
+        });
+    });
+}
+
+void PushBroadcast::decoded(std::vector<PushToken> tokens, std::vector<char> valid) {
+    for (size_t i = 0; i < tokens.size(); ++i) {
+        if (valid[i]) {
+            sender(tokens[i]);
+            ++stats.queued;
+        } else {
+            ++stats.skipped;
+        }
+    }
+
+    readPage();
+}
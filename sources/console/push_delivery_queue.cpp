@@ -0,0 +1,200 @@
+/*
+ * ExtraChain Console Client
+ * Copyright (C) 2025 ExtraChain Foundation <official@extrachain.io>
+ *
+ * This library is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "console/push_delivery_queue.h"
+
+#include <QJsonArray>
+#include <QJsonDocument>
+
+#include <algorithm>
+
+#include "utils/exc_logs.h"
+
+PushDeliveryQueue::PushDeliveryQueue(QObject *parent)
+    : QObject(parent) {
+    flushTimer.setSingleShot(true);
+    flushTimer.setInterval(flushInterval);
+    connect(&flushTimer, &QTimer::timeout, this, &PushDeliveryQueue::flush);
+    setShards(1);
+}
+
+void PushDeliveryQueue::setShards(int count) {
+    while (managers.size() < static_cast<size_t>(std::max(count, 1))) {
+        managers.push_back(new QNetworkAccessManager(this));
+        inFlight.push_back(0);
+    }
+}
+
+PushDeliveryQueue::Stats PushDeliveryQueue::stats() const {
+    return counters;
+}
+
+void PushDeliveryQueue::enqueue(const QString &server, Message message) {
+    auto &messages = collecting[server];
+    messages.push_back(std::move(message));
+
+    if (messages.size() >= batchSize)
+        flush();
+    else if (!flushTimer.isActive())
+        flushTimer.start();
+}
+
+void PushDeliveryQueue::flush() {
+    flushTimer.stop();
+    for (auto it = collecting.begin(); it != collecting.end(); ++it) {
+        auto &messages = it.value();
+        for (size_t begin = 0; begin < messages.size(); begin += batchSize) {
+            const size_t end = std::min(messages.size(), begin + batchSize);
+            ready.push_back({ .server   = it.key(),
+                              .messages = std::vector<Message>(std::make_move_iterator(messages.begin() + begin),
+                                                               std::make_move_iterator(messages.begin() + end)) });
+        }
+    }
+    collecting.clear();
+    sendNext();
+}
+
+int PushDeliveryQueue::freeShard() {
+    for (size_t i = 0; i < managers.size(); ++i) {
+        const size_t shard = (nextShard + i) % managers.size();
+        if (inFlight[shard] < maxInFlight) {
+            nextShard = shard + 1;
+            return static_cast<int>(shard);
+        }
+    }
+    return -1;
+}
+
+void PushDeliveryQueue::sendNext() {
+    while (!ready.empty()) {
+        const int shard = freeShard();
+        if (shard < 0)
+            return;
+
+        auto batch = std::move(ready.front());
+        ready.pop_front();
+        send(shard, std::move(batch));
+    }
+}
+
+void PushDeliveryQueue::send(int shard, Batch batch) {
+    QJsonArray notifications;
+    for (const auto &message : batch.messages)
+        notifications.append(message.payload);
+
+    QNetworkRequest request(QUrl(batch.server + "batch"));
+    request.setHeader(QNetworkRequest::ContentTypeHeader, "application/json");
+
+    ++inFlight[shard];
+    const auto body  = QJsonDocument(QJsonObject { { "notifications", notifications } }).toJson();
+    auto       reply = managers[shard]->post(request, body);
+    connect(reply, &QNetworkReply::finished, this, [this, shard, reply, batch = std::move(batch)]() mutable {
+        --inFlight[shard];
+        reply->deleteLater();
+        resolve(reply, std::move(batch));
+        sendNext();
+    });
+}
+
+void PushDeliveryQueue::resolve(QNetworkReply *reply, Batch batch) {
+    // no status means the request never got an HTTP answer
+    const int status = reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
+    if (status == 0 || status == 429 || status >= 500) {
+        eLog("[Push] Batch of {} to {} failed: {}", batch.messages.size(), batch.server, reply->errorString());
+        retry(std::move(batch));
+        return;
+    }
+    if (reply->error() != QNetworkReply::NoError) {
+        // other 4xx answers will not change on a retry
+        counters.dropped += static_cast<qint64>(batch.messages.size());
+        eLog("[Push] Batch of {} to {} rejected with HTTP {}: {}",
+             batch.messages.size(),
+             batch.server,
+             status,
+             reply->errorString());
+        return;
+    }
+
+    // a token can be in a batch more than once, every answer takes the first unanswered message
+    QMultiHash<QString, size_t> index;
+    for (size_t i = 0; i < batch.messages.size(); ++i)
+        index.insert(batch.messages[i].token, i);
+
+    Batch             again { .server = batch.server, .attempt = batch.attempt };
+    std::vector<char> answered(batch.messages.size(), 0);
+    int               sent = 0;
+    auto              json = QJsonDocument::fromJson(reply->readAll());
+    for (const auto &value : json["results"].toArray()) {
+        auto    result    = value.toObject();
+        QString token     = result["token"].toString();
+        QString errorType = result["errorType"].toString();
+        auto    range     = index.equal_range(token);
+        auto    it        = std::find_if(range.first, range.second, [&](size_t i) { return !answered[i]; });
+        if (it == range.second)
+            continue;
+
+        auto &message = batch.messages[*it];
+        answered[*it] = 1;
+        if (errorType == "None") {
+            ++sent;
+        } else if (errorType == "BadDeviceToken" || errorType == "Unregistered") {
+            ++counters.rejected;
+            eLog("[Push] Remove token {}", token);
+            emit tokenRejected(message.actorKey, token);
+        } else if (errorType == "ConnectionError") {
+            again.messages.push_back(std::move(message));
+        } else {
+            ++counters.failed;
+            eLog("[Push] Error: {} {}", errorType, result["errorText"].toString());
+        }
+    }
+
+    // the server skipped these tokens, so their delivery is unknown
+    const size_t missing = std::count(answered.begin(), answered.end(), 0);
+    if (missing > 0) {
+        eLog("[Push] Batch to {}: no result for {} tokens, requeued", batch.server, missing);
+        for (size_t i = 0; i < batch.messages.size(); ++i) {
+            if (!answered[i])
+                again.messages.push_back(std::move(batch.messages[i]));
+        }
+    }
+
+    counters.sent += sent;
+    eLog("[Push] Batch to {}: {}/{} sent", batch.server, sent, batch.messages.size());
+    if (!again.messages.empty())
+        retry(std::move(again));
+}
+
+void PushDeliveryQueue::retry(Batch batch) {
+    if (++batch.attempt >= maxAttempts) {
+        counters.dropped += static_cast<qint64>(batch.messages.size());
+        eLog("[Push] Dropped {} notifications to {} after {} attempts",
+             batch.messages.size(),
+             batch.server,
+             batch.attempt);
+        return;
+    }
+
+    counters.retried += static_cast<qint64>(batch.messages.size());
+    const int delay = retryDelay << (batch.attempt - 1);
+    QTimer::singleShot(delay, this, [this, batch = std::move(batch)]() mutable {
+        ready.push_back(std::move(batch));
+        sendNext();
+    });
+}
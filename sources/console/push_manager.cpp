@@ -19,56 +19,90 @@
 
 #include "console/push_manager.h"
 
+#include <QJsonDocument>
 #include <QJsonObject>
 
 #include "chain/actor_index.h"
+#include "console/notification_coalescer.h"
+#include "console/push_broadcast.h"
 
 PushManager::PushManager(ExtraChainNode *node, QObject *parent)
-    : QObject(parent) {
-    manager = new QNetworkAccessManager(this);
-    connect(manager, &QNetworkAccessManager::finished, this, &PushManager::responseResolver);
+    : QObject(parent)
+    , node(node) {
+    deliveryQueue = new PushDeliveryQueue(this);
+    deliveryQueue->setShards(deliveryShards);
+    coalescer = new NotificationCoalescer(this);
+    connect(coalescer, &NotificationCoalescer::ready, this, &PushManager::deliver);
+    connect(deliveryQueue, &PushDeliveryQueue::tokenRejected, this, [this](std::string actorKey, QString token) {
+        tokenStore.remove(actorKey, token.toStdString());
+    });
+}
+
+void PushManager::setAccController(ExtraChainNode *node) {
+    this->node = node;
 }
 
 void PushManager::pushNotification(QString actorId, Notification notification) {
-    if (!QFile::exists("notification"))
-        return;
+    coalescer->add(actorId, notification);
+}
 
-    auto main = node->accountController()->system_actor();
-    if (main.id() != node->actorIndex()->network_id())
+void PushManager::deliver(QString actorId, Notification notification, int count) {
+    if (!openTokenStore(false))
         return;
-    auto &key = main.key();
 
-    auto        encrypt_res      = key.encrypt_self(ByteArray(actorId).toBytes());
-    QByteArray  actorIdEncrypted = ByteArray(encrypt_res.value()).toQByteArray();
-    DbConnector db("notification");
-    db.open();
-    auto res = actorId == "all" ? db.select("SELECT * FROM Notification")
-                                : db.select("SELECT * FROM Notification WHERE actorId = ?;",
-                                            "Notification",
-                                            { { "actorId", actorIdEncrypted.toStdString() } });
+    // tokens are stored sealed with the node key, decode owns a copy of it for the broadcast workers
+    auto key    = node->accountController()->system_actor().key();
+    auto decode = [key](PushToken &token) {
+        token.token = ByteArray(key.decrypt_self(ByteArray(token.token).toBytes())).toString();
+        token.os    = ByteArray(key.decrypt_self(ByteArray(token.os).toBytes())).toString();
+        return token.os == "ios" || token.os == "android";
+    };
+    auto send = [this, actorId, notification, count](const PushToken &token) {
+        eLog("[Push] New notification: {} {}", actorId, notification.data);
+        sendNotification(token, QString::fromStdString(token.os), notification, count);
+    };
+
+    if (actorId == "all") {
+        auto broadcast = new PushBroadcast(&tokenStore, decode, send, this);
+        connect(broadcast, &PushBroadcast::finished, this, [this, broadcast] {
+            auto stats = deliveryQueue->stats();
+            eLog("[Push] Delivery totals: {} sent, {} rejected, {} failed, {} retried, {} dropped",
+                 stats.sent,
+                 stats.rejected,
+                 stats.failed,
+                 stats.retried,
+                 stats.dropped);
+            broadcast->deleteLater();
+        });
+        broadcast->start(broadcastPageSize);
+        return;
+    }
 
-    if (res.size() == 0) {
+    auto tokens = tokenStore.tokens(actorId.toStdString());
+    if (tokens.empty()) {
         eLog("[Push] Actor with id {} has not configured any push", actorId);
         return;
     }
+    for (auto &token : tokens) {
+        if (decode(token))
+            send(token);
+    }
+}
 
-    for (auto &&el : res) {
-        // QString token = ByteArray(key.decrypt_self(ByteArray(el["token"]).toBytes())).toQString();
-        // QString os    = ByteArray(key.decrypt_self(ByteArray(el["os"]).toBytes())).toQString();
+bool PushManager::openTokenStore(bool create) {
+    if (node == nullptr)
+        return false;
 
-        // if (os == "ios" || os == "android") {
-        //     eLog("[Push] New notification: {} {}", actorId, notification.data);
-        //     sendNotification(token, os, notification);
-        // }
-    }
+    // only the network node keeps push tokens, indexed with its own secret key
+    auto main = node->accountController()->system_actor();
+    if (main.id() != node->actorIndex()->network_id())
+        return false;
+    return tokenStore.open(create, ByteArray(main.key().secret_key()).toQByteArray());
 }
 
 void PushManager::saveNotificationToken(QByteArray os, ActorId actorId, ActorId token) {
-    static const std::string notificationTableCreation = //
-        "CREATE TABLE IF NOT EXISTS Notification ("
-        "token    BLOB PRIMARY KEY NOT NULL, "
-        "actorId  BLOB             NOT NULL, "
-        "os       BLOB             NOT NULL);";
+    if (node == nullptr)
+        return;
 
     auto main = node->accountController()->system_actor();
     if (main.id() != node->actorIndex()->network_id())
@@ -85,11 +119,12 @@ void PushManager::saveNotificationToken(QByteArray os, ActorId actorId, ActorId
     //     return;
     // }
 
-    // DbConnector db("notification");
-    // db.open();
-    // db.create_table(notificationTableCreation);
-    // db.delete_row("Notification", { { "token", osToken } });
-    // db.insert("Notification", { { "actorId", osActorId }, { "token", osToken }, { "os", osDecrypted } });
+    // if (!openTokenStore(true))
+    //     return;
+    // tokenStore.save(osActorId,
+    //                 osToken,
+    //                 ByteArray(key.encrypt_self(ByteArray(osToken).toBytes()).value()).toString(),
+    //                 ByteArray(key.encrypt_self(ByteArray(osDecrypted).toBytes()).value()).toString());
 
     // eLog("[Push] Saved {} {} {}",
     //      QByteArray::fromStdString(osDecrypted),
@@ -97,39 +132,6 @@ void PushManager::saveNotificationToken(QByteArray os, ActorId actorId, ActorId
     //      QByteArray::fromStdString(osToken));
 }
 
-void PushManager::responseResolver(QNetworkReply *reply) {
-    // eLog("[Push] Result from url {}", reply->url().toString());
-
-    if (reply->error()) {
-        eLog("[Push] Error: {}", reply->errorString());
-        return;
-    }
-
-    QByteArray answer = reply->readAll();
-    auto       json   = QJsonDocument::fromJson(answer);
-    eLog("[Push] Result: {}", json.toJson(QJsonDocument::Compact));
-
-    // QString errorType = json["errorType"].toString();
-    // if (errorType == "None") {
-    //     eLog("[Push] Successfully sent for {}", json["errorText"].toString());
-    // } else if (errorType == "BadDeviceToken" || errorType == "Unregistered") {
-    //     QString token = json["errorText"].toString();
-    //     eLog("[Push] Remove token {}", token);
-
-    //     auto &main = node->accountController()->mainActor();
-    //     auto &key  = main->key();
-
-    //     DbConnector db("notification");
-    //     db.open();
-    //     db.delete_row("Notification",
-    //                   { { "token",
-    //                       ByteArray(key.encrypt_self(ByteArray(token.toStdString()).toBytes())).toString() } });
-    // } else {
-    //     eLog("[Push] Error: {} {}", errorType, json["errorText"].toString());
-    //     // TODO: repeat request, ConnectionError
-    // }
-}
-
 void PushManager::chatMessage(QString sender, QString msgPath) {
     //    QString userId = msgPath.mid(DfsStruct::ROOT_FOOLDER_NAME_MID, 40);
     //    QString chatId = msgPath.mid(32, 64);
@@ -167,20 +169,54 @@ void PushManager::chatMessage(QString sender, QString msgPath) {
 //    }
 //}
 
-void PushManager::sendNotification(const QString &token, const QString &os, const Notification &notification) {
+void PushManager::sendNotification(const PushToken    &token,
+                                   const QString      &os,
+                                   const Notification &notification,
+                                   int                 count) {
     QJsonObject json;
     json["os"]      = os;
-    json["token"]   = token;
-    json["message"] = notificationToMessage(notification);
+    json["token"]   = QString::fromStdString(token.token);
+    json["message"] = count > 1 ? summaryMessage(notification, count) : notificationToMessage(notification);
 
     QJsonObject data;
     data["notifyType"] = notification.type;
     data["data"]       = QString(notification.data);
+    data["count"]      = count;
     json["data"]       = data;
 
-    QString jsonStr = QJsonDocument(json).toJson();
     eLog("[Push] Send {}", QJsonDocument(json).toJson(QJsonDocument::Compact));
-    manager->get(QNetworkRequest(QUrl(pushServerUrl + jsonStr)));
+    deliveryQueue->enqueue(pushServerUrl,
+                           { .actorKey = token.actorKey, .token = json["token"].toString(), .payload = json });
+}
+
+QString PushManager::summaryMessage(const Notification &notification, int count) {
+    QString what;
+    switch (notification.type) {
+    case (Notification::NotifyType::TxToUser):
+    case (Notification::NotifyType::TxToMe):
+        what = "transactions";
+        break;
+    case (Notification::NotifyType::ChatMsg):
+        what = "messages";
+        break;
+    case (Notification::NotifyType::ChatInvite):
+        what = "chats";
+        break;
+    case (Notification::NotifyType::NewPost):
+        what = "posts";
+        break;
+    case (Notification::NotifyType::NewEvent):
+        what = "events";
+        break;
+    case (Notification::NotifyType::NewFollower):
+        what = "followers";
+        break;
+    default:
+        what = "notifications";
+        break;
+    }
+
+    return QString("%1 new %2").arg(count).arg(what);
 }
 
 QString PushManager::notificationToMessage(const Notification &notification) {
@@ -0,0 +1,199 @@
+/*
+ * ExtraChain Console Client
+ * Copyright (C) 2025 ExtraChain Foundation <official@extrachain.io>
+ *
+ * This library is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "console/push_token_store.h"
+
+#include <QCryptographicHash>
+#include <QFile>
+#include <QMessageAuthenticationCode>
+
+#include <sqlite3.h>
+
+#include "utils/exc_logs.h"
+
+namespace {
+// identity of a row is (actorKey, tokenKey), both keyed hashes, token and os are sealed blobs
+const char *tokenTableCreation = //
+    "CREATE TABLE IF NOT EXISTS PushToken ("
+    "actorKey TEXT NOT NULL, "
+    "tokenKey TEXT NOT NULL, "
+    "token    BLOB NOT NULL, "
+    "os       BLOB NOT NULL, "
+    "PRIMARY KEY (actorKey, tokenKey));";
+// the Notification table of earlier versions shares this file and is left untouched
+
+const char *queries[] = {
+    "SELECT token, os FROM PushToken WHERE actorKey = ?1;",
+    "INSERT OR REPLACE INTO PushToken (actorKey, tokenKey, token, os) VALUES (?1, ?2, ?3, ?4);",
+    "DELETE FROM PushToken WHERE actorKey = ?1 AND tokenKey = ?2;",
+    "SELECT rowid, actorKey, token, os FROM PushToken WHERE rowid > ?1 ORDER BY rowid LIMIT ?2;",
+};
+
+void bindText(sqlite3_stmt *statement, int index, const std::string &value) {
+    sqlite3_bind_text(statement, index, value.data(), static_cast<int>(value.size()), SQLITE_TRANSIENT);
+}
+
+void bindBlob(sqlite3_stmt *statement, int index, const std::string &value) {
+    sqlite3_bind_blob(statement, index, value.data(), static_cast<int>(value.size()), SQLITE_TRANSIENT);
+}
+
+std::string column(sqlite3_stmt *statement, int index) {
+    const auto data = static_cast<const char *>(sqlite3_column_blob(statement, index));
+    return data == nullptr ? std::string() : std::string(data, sqlite3_column_bytes(statement, index));
+}
+}
+
+PushTokenStore::PushTokenStore(const std::string &name)
+    : name(name)
+    , cache(cacheSize) {
+}
+
+PushTokenStore::~PushTokenStore() {
+    for (auto statement : statements)
+        sqlite3_finalize(statement);
+    sqlite3_close(db);
+}
+
+bool PushTokenStore::open(bool create, const QByteArray &secretKey) {
+    if (db != nullptr)
+        return true;
+    if (!create && !QFile::exists(QString::fromStdString(name)))
+        return false;
+    if (secretKey.isEmpty()) {
+        eLog("[Push] No secret key to index {} database", name);
+        return false;
+    }
+
+    auto fail = [this](const char *what) {
+        eLog("[Push] Can't {} {} database: {}", what, name, sqlite3_errmsg(db));
+        for (auto &statement : statements) {
+            sqlite3_finalize(statement);
+            statement = nullptr;
+        }
+        sqlite3_close(db);
+        db = nullptr;
+        return false;
+    };
+
+    if (sqlite3_open(name.c_str(), &db) != SQLITE_OK)
+        return fail("open");
+    if (sqlite3_exec(db, tokenTableCreation, nullptr, nullptr, nullptr) != SQLITE_OK)
+        return fail("prepare");
+    for (int i = 0; i < StatementCount; ++i) {
+        const auto flags = SQLITE_PREPARE_PERSISTENT;
+        if (sqlite3_prepare_v3(db, queries[i], -1, flags, &statements[i], nullptr) != SQLITE_OK)
+            return fail("prepare");
+    }
+
+    // the index key never leaves memory, a copy of the database can't be matched to actor ids
+    indexKey = QMessageAuthenticationCode::hash("extrachain-push-index", secretKey, QCryptographicHash::Sha256);
+    return true;
+}
+
+bool PushTokenStore::isOpen() const {
+    return db != nullptr;
+}
+
+std::string PushTokenStore::keyedHash(const std::string &message) const {
+    const auto hash =
+        QMessageAuthenticationCode::hash(QByteArray::fromStdString(message), indexKey, QCryptographicHash::Sha256);
+    return hash.toHex().toStdString();
+}
+
+bool PushTokenStore::step(Statement statement) {
+    const int result = sqlite3_step(statements[statement]);
+    if (result != SQLITE_ROW && result != SQLITE_DONE)
+        eLog("[Push] Query on {} failed: {}", name, sqlite3_errmsg(db));
+    return result == SQLITE_ROW;
+}
+
+std::string PushTokenStore::actorKey(const std::string &actorId) const {
+    return keyedHash("actor:" + actorId);
+}
+
+std::vector<PushToken> PushTokenStore::tokens(const std::string &actorId) {
+    const auto    key      = actorKey(actorId);
+    const QString cacheKey = QString::fromStdString(key);
+    if (auto cached = cache.object(cacheKey))
+        return *cached;
+    if (db == nullptr)
+        return {};
+
+    auto statement = statements[SelectTokens];
+    bindText(statement, 1, key);
+
+    auto result = new std::vector<PushToken>();
+    while (step(SelectTokens))
+        result->push_back({ .actorKey = key, .token = column(statement, 0), .os = column(statement, 1) });
+    sqlite3_reset(statement);
+
+    auto copy = *result;
+    cache.insert(cacheKey, result);
+    return copy;
+}
+
+void PushTokenStore::save(const std::string &actorId,
+                          const std::string &token,
+                          const std::string &sealedToken,
+                          const std::string &sealedOs) {
+    if (db == nullptr)
+        return;
+
+    const auto key       = actorKey(actorId);
+    auto       statement = statements[InsertToken];
+    bindText(statement, 1, key);
+    bindText(statement, 2, keyedHash("token:" + token));
+    bindBlob(statement, 3, sealedToken);
+    bindBlob(statement, 4, sealedOs);
+    step(InsertToken);
+    sqlite3_reset(statement);
+    cache.remove(QString::fromStdString(key));
+}
+
+void PushTokenStore::remove(const std::string &actorKey, const std::string &token) {
+    if (db == nullptr)
+        return;
+
+    auto statement = statements[DeleteToken];
+    bindText(statement, 1, actorKey);
+    bindText(statement, 2, keyedHash("token:" + token));
+    step(DeleteToken);
+    sqlite3_reset(statement);
+    cache.remove(QString::fromStdString(actorKey));
+}
+
+std::vector<PushToken> PushTokenStore::page(qint64 &afterRowid, int limit) {
+    if (db == nullptr)
+        return {};
+
+    auto statement = statements[PageTokens];
+    sqlite3_bind_int64(statement, 1, afterRowid);
+    sqlite3_bind_int(statement, 2, limit);
+
+    std::vector<PushToken> result;
+    result.reserve(limit);
+    while (step(PageTokens)) {
+        afterRowid = sqlite3_column_int64(statement, 0);
+        result.push_back({ .actorKey = column(statement, 1),
+                           .token    = column(statement, 2),
+                           .os       = column(statement, 3) });
+    }
+    sqlite3_reset(statement);
+    return result;
+}
@@ -0,0 +1,80 @@
+/*
+ * ExtraChain Console Client
+ * Copyright (C) 2025 ExtraChain Foundation <official@extrachain.io>
+ *
+ * This library is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "console/startup_profiler.h"
+
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QSaveFile>
+
+#include "utils/exc_logs.h"
+
+StartupProfiler::StartupProfiler() {
+    timer.start();
+}
+
+void StartupProfiler::begin(const QString &name) {
+    end();
+    list.push_back({ .name = name, .startMs = timer.elapsed() });
+    running = true;
+}
+
+void StartupProfiler::end() {
+    if (!running)
+        return;
+
+    list.back().durationMs = timer.elapsed() - list.back().startMs;
+    running                = false;
+}
+
+qint64 StartupProfiler::elapsed() const {
+    return timer.elapsed();
+}
+
+const std::vector<StartupProfiler::Phase> &StartupProfiler::phases() const {
+    return list;
+}
+
+void StartupProfiler::print() const {
+    const qint64 total = std::max<qint64>(elapsed(), 1);
+
+    eInfo("[Startup] {} {} {}", QString("Phase").leftJustified(36), QString("ms").rightJustified(8), "    %");
+    for (const auto &phase : list) {
+        eInfo("[Startup] {} {} {}",
+              phase.name.leftJustified(36),
+              QString::number(phase.durationMs).rightJustified(8),
+              QString::number(100.0 * phase.durationMs / total, 'f', 1).rightJustified(5));
+    }
+    eInfo("[Startup] {} {}", QString("Total").leftJustified(36), QString::number(total).rightJustified(8));
+}
+
+bool StartupProfiler::save(const QString &path) const {
+    QJsonArray phases;
+    for (const auto &phase : list)
+        phases.append(
+            QJsonObject { { "name", phase.name }, { "start_ms", phase.startMs }, { "ms", phase.durationMs } });
+
+    QJsonObject json;
+    json["total_ms"] = elapsed();
+    json["phases"]   = phases;
+
+    QSaveFile file(path);
+    return file.open(QFile::WriteOnly) && file.write(QJsonDocument(json).toJson()) >= 0 && file.commit();
+}
@@ -0,0 +1,184 @@
+/*
+ * ExtraChain Console Client
+ * Copyright (C) 2025 ExtraChain Foundation <official@extrachain.io>
+ *
+ * This library is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "console/transaction_batch.h"
+
+#include <QFile>
+#include <QTimer>
+
+#include <algorithm>
+#include <cctype>
+#include <optional>
+
+#include "console/parallel.h"
+#include "managers/account_controller.h"
+#include "utils/exc_logs.h"
+
+namespace {
+std::string_view trimmed(std::string_view value) {
+    while (!value.empty() && std::isspace(static_cast<unsigned char>(value.front())))
+        value.remove_prefix(1);
+    while (!value.empty() && std::isspace(static_cast<unsigned char>(value.back())))
+        value.remove_suffix(1);
+    return value;
+}
+
+std::string_view nextField(std::string_view &line) {
+    auto comma = line.find(',');
+    auto field = line.substr(0, comma);
+    line.remove_prefix(comma == std::string_view::npos ? line.size() : comma + 1);
+    return trimmed(field);
+}
+}
+
+TransactionBatch::TransactionBatch(ExtraChainNode *node, QObject *parent)
+    : QObject(parent)
+    , node(node) {
+}
+
+Transaction TransactionBatch::makeTransaction(const ActorId                &sender,
+                                              const ActorId                &receiver,
+                                              const BigNumberFloat         &amount,
+                                              const std::optional<ActorId> &token) {
+    Transaction tx;
+    tx.set_sender(sender);
+    tx.set_receiver(receiver);
+    tx.set_amount(amount);
+    // without a token column the transaction keeps the default token, like the "transaction" command
+    if (token.has_value())
+        tx.set_token(*token);
+    return tx;
+}
+
+bool TransactionBatch::isActorId(std::string_view value) {
+    return value.size() == 40 && std::all_of(value.begin(), value.end(), [](char c) {
+               return std::isxdigit(static_cast<unsigned char>(c));
+           });
+}
+
+bool TransactionBatch::isAmount(std::string_view value) {
+    bool digits = false;
+    bool dot    = false;
+    for (char c : value) {
+        if (c == '.' && !dot)
+            dot = true;
+        else if (std::isdigit(static_cast<unsigned char>(c)))
+            digits = true;
+        else
+            return false;
+    }
+    return digits;
+}
+
+bool TransactionBatch::load(const QString &path) {
+    QFile file(path);
+    if (!file.open(QFile::ReadOnly)) {
+        eInfo("[Tx batch] Can't open {}: {}", path, file.errorString());
+        return false;
+    }
+
+    const QByteArray              data = file.readAll();
+    std::vector<std::string_view> lines;
+    for (std::string_view rest(data.constData(), data.size()); !rest.empty();) {
+        auto end = rest.find('\n');
+        lines.push_back(rest.substr(0, end));
+        rest.remove_prefix(end == std::string_view::npos ? rest.size() : end + 1);
+    }
+
+    enum LineState : char {
+        Skipped,
+        Parsed,
+        Invalid
+    };
+
+    const auto                              sender = node->accountController()->system_actor().id();
+    std::vector<std::optional<Transaction>> parsed(lines.size());
+    std::vector<LineState>                  states(lines.size(), Skipped);
+    parallelFor(lines.size(), [&](size_t i) {
+        auto line = trimmed(lines[i]);
+        if (line.empty() || line.front() == '#')
+            return;
+
+        auto receiver = nextField(line);
+        auto amount   = nextField(line);
+        auto token    = nextField(line);
+        if (receiver == "receiver") // header
+            return;
+
+        if ((receiver != "burn" && !isActorId(receiver)) || !isAmount(amount)
+            || (!token.empty() && !isActorId(token)) || !trimmed(line).empty()) {
+            states[i] = Invalid;
+            return;
+        }
+
+        parsed[i] = makeTransaction(sender,
+                                    receiver == "burn" ? ActorId() : ActorId(std::string(receiver)),
+                                    BigNumberFloat(std::string(amount)),
+                                    token.empty() ? std::nullopt : std::optional(ActorId(std::string(token))));
+        states[i] = Parsed;
+    });
+
+    transactions.reserve(lines.size());
+    for (size_t i = 0; i < lines.size(); ++i) {
+        if (states[i] == Parsed) {
+            transactions.push_back(std::move(*parsed[i]));
+        } else if (states[i] == Invalid) {
+            if (++rejected <= 10)
+                eInfo("[Tx batch] Invalid line {}: {}", i + 1, std::string(lines[i]));
+        }
+    }
+
+    eInfo("[Tx batch] Loaded {} transactions, {} invalid lines", transactions.size(), rejected);
+    return true;
+}
+
+void TransactionBatch::setChunkSize(int size) {
+    if (size > 0)
+        chunkSize = size;
+}
+
+void TransactionBatch::start() {
+    timer.start();
+    submitNext();
+}
+
+void TransactionBatch::submitNext() {
+    auto       &&actor = node->accountController()->system_actor();
+    const size_t end   = std::min(transactions.size(), next + static_cast<size_t>(chunkSize));
+    for (; next < end; ++next) {
+        if (node->send_transaction(transactions[next], actor))
+            ++accepted;
+        else
+            ++rejected;
+    }
+
+    if (next < transactions.size()) {
+        QTimer::singleShot(0, this, &TransactionBatch::submitNext);
+        return;
+    }
+
+    const qint64 elapsed = std::max<qint64>(timer.elapsed(), 1);
+    eInfo("[Tx batch] Accepted {}, rejected {}, {} ms, {} tx/s",
+          accepted,
+          rejected,
+          elapsed,
+          accepted * 1000 / elapsed);
+    transactions.clear();
+    emit finished(accepted, rejected);
+}
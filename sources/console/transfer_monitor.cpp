@@ -0,0 +1,127 @@
+/*
+ * ExtraChain Console Client
+ * Copyright (C) 2025 ExtraChain Foundation <official@extrachain.io>
+ *
+ * This library is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "console/transfer_monitor.h"
+
+#include "utils/exc_logs.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+constexpr qint64 percentUnits  = 10000; // percent * 100
+constexpr double rateSmoothing = 0.3;
+
+QString formatRate(double rate, bool bytes) {
+    if (!bytes)
+        return QString("%1%/s").arg(rate * 100 / percentUnits, 0, 'f', 1);
+    return QString("%1 MB/s").arg(rate / (1024 * 1024), 0, 'f', 1);
+}
+}
+
+TransferMonitor::TransferMonitor(QObject *parent)
+    : QObject(parent) {
+    clock.start();
+    timer.setInterval(logInterval);
+    connect(&timer, &QTimer::timeout, this, &TransferMonitor::flush);
+}
+
+void TransferMonitor::update(Direction direction, const Key &key, int percent) {
+    update(direction, key, static_cast<qint64>(std::clamp(percent, 0, 100)) * 100, 0);
+}
+
+void TransferMonitor::update(Direction direction, const Key &key, qint64 done, qint64 total) {
+    auto        &active   = transfers[static_cast<int>(direction)];
+    const qint64 now      = clock.elapsed();
+    auto         it       = active.try_emplace(key, Transfer { .startedAt = now, .updatedAt = now }).first;
+    auto        &transfer = it->second;
+
+    const qint64 limit = total > 0 ? total : percentUnits;
+    if (now > transfer.updatedAt && done > transfer.done) {
+        const double instant = static_cast<double>(done - transfer.done) * 1000 / (now - transfer.updatedAt);
+        transfer.rate        = transfer.rate == 0 ? instant : std::lerp(transfer.rate, instant, rateSmoothing);
+        transfer.updatedAt   = now;
+    }
+    transfer.done  = done;
+    transfer.total = total;
+
+    if (done >= limit)
+        active.erase(it);
+
+    dirty = true;
+    if (!timer.isActive())
+        timer.start();
+}
+
+void TransferMonitor::remove(Direction direction, const Key &key) {
+    if (transfers[static_cast<int>(direction)].erase(key) > 0)
+        dirty = true;
+}
+
+bool TransferMonitor::empty() const {
+    return std::all_of(transfers.begin(), transfers.end(), [](const Transfers &active) {
+        return active.empty();
+    });
+}
+
+QString TransferMonitor::summary(Direction direction) const {
+    static const char *names[] = { "up", "down", "export" };
+
+    const auto &active = transfers[static_cast<int>(direction)];
+    if (active.empty())
+        return {};
+
+    double rate      = 0;
+    double average   = 0;
+    double remaining = 0;
+    bool   bytes     = false;
+    for (const auto &[key, transfer] : active) {
+        const qint64 limit   = transfer.total > 0 ? transfer.total : percentUnits;
+        const qint64 elapsed = std::max<qint64>(transfer.updatedAt - transfer.startedAt, 1);
+        bytes                = bytes || transfer.total > 0;
+        rate += transfer.rate;
+        average += static_cast<double>(transfer.done) * 1000 / elapsed;
+        if (transfer.rate > 0)
+            remaining = std::max(remaining, (limit - transfer.done) / transfer.rate);
+    }
+
+    return QString("%1 %2: %3 (avg %4), ETA %5s")
+        .arg(names[static_cast<int>(direction)])
+        .arg(active.size())
+        .arg(formatRate(rate, bytes), formatRate(average, bytes))
+        .arg(static_cast<qint64>(remaining));
+}
+
+void TransferMonitor::flush() {
+    if (!dirty) {
+        if (empty())
+            timer.stop();
+        return;
+    }
+    dirty = false;
+
+    // goes through the logger like every other line, so it never interleaves with it
+    QStringList parts;
+    for (auto direction : { Direction::Upload, Direction::Download, Direction::Export }) {
+        auto part = summary(direction);
+        if (!part.isEmpty())
+            parts << part;
+    }
+    eLog("[Console/Dfs] {}", parts.isEmpty() ? QString("no active transfers") : parts.join(" | "));
+}
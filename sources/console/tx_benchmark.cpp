@@ -0,0 +1,137 @@
+/*
+ * ExtraChain Console Client
+ * Copyright (C) 2025 ExtraChain Foundation <official@extrachain.io>
+ *
+ * This library is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "console/tx_benchmark.h"
+
+#include <QDateTime>
+#include <QJsonDocument>
+#include <QSaveFile>
+
+#include <cmath>
+
+#include "console/transaction_batch.h"
+#include "extrachain_version.h"
+#include "managers/account_controller.h"
+#include "utils/exc_logs.h"
+
+namespace {
+constexpr int    tickInterval = 10;  // ms
+constexpr qint64 burstLimit   = 256; // transactions per tick when rate is unlimited
+
+// nearest-rank percentile, the smallest value with at least value * size samples at or below it
+qint64 percentile(const std::vector<qint64> &sorted, double value) {
+    if (sorted.empty())
+        return 0;
+    const auto rank = static_cast<size_t>(std::ceil(value * static_cast<double>(sorted.size())));
+    return sorted[std::min(sorted.size() - 1, std::max<size_t>(rank, 1) - 1)];
+}
+}
+
+TxBenchmark::TxBenchmark(ExtraChainNode *node, QObject *parent)
+    : QObject(parent)
+    , node(node) {
+    ticker.setInterval(tickInterval);
+    connect(&ticker, &QTimer::timeout, this, &TxBenchmark::tick);
+}
+
+void TxBenchmark::setCount(qint64 value) {
+    if (value > 0)
+        count = value;
+}
+
+void TxBenchmark::setRate(qint64 value) {
+    rate = std::max<qint64>(value, 0);
+}
+
+void TxBenchmark::setReceiver(const ActorId &value) {
+    receiver = value;
+}
+
+void TxBenchmark::start() {
+    if (!receiver.has_value())
+        receiver = node->accountController()->system_actor().id();
+
+    latencies.clear();
+    latencies.reserve(count);
+    sent     = 0;
+    accepted = 0;
+    rejected = 0;
+    eInfo("[Bench] {} transactions, rate {}", count, rate == 0 ? QString("max") : QString::number(rate));
+    timer.start();
+    ticker.start();
+}
+
+void TxBenchmark::tick() {
+    const qint64 due    = rate == 0 ? sent + burstLimit : timer.elapsed() * rate / 1000;
+    const qint64 target = std::min(count, due);
+
+    auto &&actor  = node->accountController()->system_actor();
+    auto   sender = actor.id();
+    for (; sent < target; ++sent) {
+        auto tx = TransactionBatch::makeTransaction(sender, *receiver, BigNumberFloat("1"));
+
+        QElapsedTimer submit;
+        submit.start();
+        if (node->send_transaction(tx, actor))
+            ++accepted;
+        else
+            ++rejected;
+        latencies.push_back(submit.nsecsElapsed());
+    }
+
+    if (sent < count)
+        return;
+
+    ticker.stop();
+    auto result = report();
+    eInfo("[Bench] {}", QJsonDocument(result).toJson(QJsonDocument::Compact));
+
+    QSaveFile file(QString("bench-tx-%1.json").arg(QDateTime::currentDateTime().toString("yyyyMMdd-hhmmss")));
+    if (file.open(QFile::WriteOnly) && file.write(QJsonDocument(result).toJson()) >= 0 && file.commit())
+        eInfo("[Bench] Saved to {}", file.fileName());
+
+    emit finished(result);
+}
+
+QJsonObject TxBenchmark::report() const {
+    const qint64 elapsed = std::max<qint64>(timer.elapsed(), 1);
+
+    auto sorted = latencies;
+    std::sort(sorted.begin(), sorted.end());
+
+    QJsonObject latency;
+    latency["p50_us"] = percentile(sorted, 0.50) / 1000;
+    latency["p90_us"] = percentile(sorted, 0.90) / 1000;
+    latency["p99_us"] = percentile(sorted, 0.99) / 1000;
+    latency["max_us"] = sorted.empty() ? 0 : sorted.back() / 1000;
+
+    QJsonObject json;
+    json["benchmark"]      = "tx";
+    json["count"]          = sent;
+    json["accepted"]       = accepted;
+    json["rejected"]       = rejected;
+    json["target_rate"]    = rate;
+    json["duration_ms"]    = elapsed;
+    json["tps"]            = static_cast<double>(accepted) * 1000 / elapsed;
+    json["submit_latency"] = latency;
+    json["core_version"]   = QString::fromStdString(extrachain_version);
+    json["console_commit"] = GIT_COMMIT;
+    json["timestamp"]      = QDateTime::currentDateTimeUtc().toString(Qt::ISODate);
+    return json;
+}
@@ -0,0 +1,86 @@
+/*
+ * ExtraChain Console Client
+ * Copyright (C) 2025 ExtraChain Foundation <official@extrachain.io>
+ *
+ * This library is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "console/wallet_balances.h"
+
+#include <QElapsedTimer>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+
+#include "utils/exc_logs.h"
+
+std::vector<WalletBalances::Entry> WalletBalances::query(ExtraChainNode                                 *node,
+                                                         const std::vector<std::pair<QString, ActorId>> &actors) {
+    const auto current = node->dag()->current_section();
+    if (!section.has_value() || *section != current) {
+        cache.clear();
+        section = current;
+    }
+
+    std::vector<Entry>  entries(actors.size());
+    std::vector<size_t> missing;
+    for (size_t i = 0; i < actors.size(); ++i) {
+        entries[i].label   = actors[i].first;
+        entries[i].actorId = actors[i].second.toQString();
+        auto it            = cache.constFind(entries[i].actorId);
+        if (it != cache.constEnd())
+            entries[i].balance = it.value();
+        else
+            missing.push_back(i);
+    }
+
+    if (!missing.empty()) {
+        QElapsedTimer timer;
+        timer.start();
+        for (size_t index : missing) {
+            const auto balance     = node->dag()->calculate_actors_balance({ actors[index].second });
+            entries[index].balance = QString::fromStdString(fmt::format("{}", balance));
+            cache.insert(entries[index].actorId, entries[index].balance);
+        }
+        eLog("[Wallet] {} balances calculated in {} ms, {} cached",
+             missing.size(),
+             timer.elapsed(),
+             actors.size() - missing.size());
+    }
+
+    return entries;
+}
+
+void WalletBalances::invalidate(const QString &actorId) {
+    cache.remove(actorId);
+}
+
+void WalletBalances::clear() {
+    section.reset();
+    cache.clear();
+}
+
+void WalletBalances::printTable(const std::vector<Entry> &entries) {
+    for (const auto &entry : entries)
+        eInfo("{} {} {}", entry.label.leftJustified(8), entry.actorId, entry.balance);
+}
+
+QByteArray WalletBalances::toJson(const std::vector<Entry> &entries) {
+    QJsonArray array;
+    for (const auto &entry : entries)
+        array.append(
+            QJsonObject { { "label", entry.label }, { "id", entry.actorId }, { "balance", entry.balance } });
+    return QJsonDocument(array).toJson(QJsonDocument::Compact);
+}
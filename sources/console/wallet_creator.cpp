@@ -0,0 +1,92 @@
+/*
+ * ExtraChain Console Client
+ * Copyright (C) 2025 ExtraChain Foundation <official@extrachain.io>
+ *
+ * This library is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "console/wallet_creator.h"
+
+#include <QFileInfo>
+#include <QSaveFile>
+#include <QTimer>
+
+#include "managers/account_controller.h"
+#include "utils/exc_logs.h"
+
+WalletCreator::WalletCreator(ExtraChainNode *node, QObject *parent)
+    : QObject(parent)
+    , node(node) {
+}
+
+void WalletCreator::setCount(qint64 value) {
+    if (value > 0)
+        count = value;
+}
+
+void WalletCreator::setOutput(const QString &path) {
+    // the console runs inside the data directory, so a relative path ends up there
+    output = path.isEmpty() ? QString() : QFileInfo(path).absoluteFilePath();
+}
+
+void WalletCreator::start() {
+    ids.reserve(count);
+    timer.start();
+    QTimer::singleShot(0, this, &WalletCreator::step);
+}
+
+void WalletCreator::step() {
+    const qint64 end = std::min(count, static_cast<qint64>(ids.size()) + chunkSize);
+    while (ids.size() < end) {
+        auto actor = node->accountController()->createWallet();
+        if (actor.id() == ActorId()) {
+            eInfo("[Wallet] Can't create wallet {}/{}, stopping", ids.size() + 1, count);
+            failed = true;
+            break;
+        }
+        ids.append(actor.id().toQString());
+    }
+
+    if (failed || ids.size() >= count) {
+        finish();
+        return;
+    }
+
+    if (timer.elapsed() - lastReported >= 2000) {
+        lastReported = timer.elapsed();
+        eInfo("[Wallet] {}/{} wallets, {} wallets/s", ids.size(), count, ids.size() * 1000 / lastReported);
+    }
+    QTimer::singleShot(0, this, &WalletCreator::step);
+}
+
+void WalletCreator::finish() {
+    const qint64 elapsed = std::max<qint64>(timer.elapsed(), 1);
+    eInfo("[Wallet] Created {} wallets in {} ms, {} wallets/s", ids.size(), elapsed, ids.size() * 1000 / elapsed);
+    if (count == 1 && !ids.isEmpty())
+        eInfo("Wallet created: {}", ids.first());
+
+    if (!output.isEmpty() && !ids.isEmpty()) {
+        QSaveFile        file(output);
+        const QByteArray data = ids.join('\n').toUtf8() + '\n';
+        if (file.open(QFile::WriteOnly) && file.write(data) == data.size() && file.commit()) {
+            eInfo("[Wallet] Ids written to {}", output);
+        } else {
+            eInfo("[Wallet] Can't write {}: {}", output, file.errorString());
+            failed = true;
+        }
+    }
+
+    emit finished(ids.size(), !failed);
+}